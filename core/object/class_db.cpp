@@ -447,6 +447,7 @@ void ClassDB::_add_class2(const StringName &p_class, const StringName &p_inherit
 
 	classes[name] = ClassInfo();
 	ClassInfo &ti = classes[name];
+	_invalidate_property_lookups();
 	ti.name = name;
 	ti.inherits = p_inherits;
 	ti.api = current_api;
@@ -718,6 +719,7 @@ void ClassDB::bind_integer_constant(const StringName &p_class, const StringName
 	}
 
 	type->constant_map[p_name] = p_constant;
+	_invalidate_property_lookups();
 
 	String enum_name = p_enum;
 	if (!enum_name.is_empty()) {
@@ -957,6 +959,7 @@ void ClassDB::add_signal(const StringName &p_class, const MethodInfo &p_signal)
 #endif
 
 	type->signal_map[sname] = p_signal;
+	_invalidate_property_lookups();
 }
 
 void ClassDB::get_signal_list(const StringName &p_class, List<MethodInfo> *p_signals, bool p_no_inheritance) {
@@ -1109,6 +1112,7 @@ void ClassDB::add_property(const StringName &p_class, const PropertyInfo &p_pinf
 	psg.type = p_pinfo.type;
 
 	type->property_setget[p_pinfo.name] = psg;
+	_invalidate_property_lookups();
 }
 
 void ClassDB::set_property_default_value(const StringName &p_class, const StringName &p_name, const Variant &p_default) {
@@ -1202,82 +1206,136 @@ bool ClassDB::get_property_info(const StringName &p_class, const StringName &p_p
 	return false;
 }
 
-bool ClassDB::set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid) {
-	ERR_FAIL_NULL_V(p_object, false);
+const ClassDB::ClassInfo::PropertyLookupTable *ClassDB::_build_property_lookup(ClassInfo *p_type) {
+	MutexLock mutex_lock(property_lookup_mutex);
 
-	ClassInfo *type = classes.getptr(p_object->get_class_name());
-	ClassInfo *check = type;
-	while (check) {
-		const PropertySetGet *psg = check->property_setget.getptr(p_property);
-		if (psg) {
-			if (!psg->setter) {
-				if (r_valid) {
-					*r_valid = false;
+	// Read the version before the class data, so changes made while building leave the table stale.
+	uint64_t version = property_lookup_version.get();
+	ClassInfo::PropertyLookupTable *old_table = p_type->property_lookup.table.load(std::memory_order_acquire);
+	if (old_table && old_table->version == version) {
+		return old_table; // Built by another thread in the meantime.
+	}
+
+	ClassInfo::PropertyLookupTable *table = memnew(ClassInfo::PropertyLookupTable);
+	table->version = version;
+	for (ClassInfo *check = p_type; check; check = check->inherits_ptr) {
+		for (const KeyValue<StringName, PropertySetGet> &E : check->property_setget) {
+			if (table->lookup.has(E.key)) {
+				continue; // Overridden in a derived class.
+			}
+			ClassInfo::PropertyLookup lookup;
+			lookup.setget = &E.value;
+			for (ClassInfo *derived = p_type; derived != check; derived = derived->inherits_ptr) {
+				if (derived->constant_map.has(E.key) || derived->method_map.has(E.key) || derived->signal_map.has(E.key)) {
+					lookup.getter_shadowed = true;
+					break;
 				}
-				return true; //return true but do nothing
 			}
+			table->lookup.insert(E.key, lookup);
+		}
+	}
 
-			Callable::CallError ce;
+	p_type->property_lookup.table.store(table, std::memory_order_release);
+	if (old_table) {
+		retired_property_lookups.push_back(old_table);
+	}
+	return table;
+}
 
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[2] = { &index, &p_value };
-				//p_object->call(psg->setter,arg,2,ce);
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 2, ce);
-				} else {
-					p_object->callp(psg->setter, arg, 2, ce);
-				}
+const ClassDB::ClassInfo::PropertyLookup *ClassDB::_get_property_lookup(Object *p_object, const StringName &p_property) {
+	ClassInfo *type = classes.getptr(p_object->get_class_name());
+	if (!type) {
+		return nullptr;
+	}
 
-			} else {
-				const Variant *arg[1] = { &p_value };
-				if (psg->_setptr) {
-					psg->_setptr->call(p_object, arg, 1, ce);
-				} else {
-					p_object->callp(psg->setter, arg, 1, ce);
-				}
-			}
+	const ClassInfo::PropertyLookupTable *table = type->property_lookup.table.load(std::memory_order_acquire);
+	if (unlikely(!table || table->version != property_lookup_version.get())) {
+		table = _build_property_lookup(type);
+	}
 
-			if (r_valid) {
-				*r_valid = ce.error == Callable::CallError::CALL_OK;
-			}
+	return table->lookup.getptr(p_property);
+}
 
-			return true;
+bool ClassDB::set_property(Object *p_object, const StringName &p_property, const Variant &p_value, bool *r_valid) {
+	ERR_FAIL_NULL_V(p_object, false);
+
+	const ClassInfo::PropertyLookup *lookup = _get_property_lookup(p_object, p_property);
+	if (!lookup) {
+		return false;
+	}
+
+	const PropertySetGet *psg = lookup->setget;
+	if (!psg->setter) {
+		if (r_valid) {
+			*r_valid = false;
 		}
+		return true; //return true but do nothing
+	}
 
-		check = check->inherits_ptr;
+	Callable::CallError ce;
+
+	if (psg->index >= 0) {
+		Variant index = psg->index;
+		const Variant *arg[2] = { &index, &p_value };
+		//p_object->call(psg->setter,arg,2,ce);
+		if (psg->_setptr) {
+			psg->_setptr->call(p_object, arg, 2, ce);
+		} else {
+			p_object->callp(psg->setter, arg, 2, ce);
+		}
+
+	} else {
+		const Variant *arg[1] = { &p_value };
+		if (psg->_setptr) {
+			psg->_setptr->call(p_object, arg, 1, ce);
+		} else {
+			p_object->callp(psg->setter, arg, 1, ce);
+		}
 	}
 
-	return false;
+	if (r_valid) {
+		*r_valid = ce.error == Callable::CallError::CALL_OK;
+	}
+
+	return true;
+}
+
+bool ClassDB::_get_property_with_setget(Object *p_object, const PropertySetGet *p_psg, Variant &r_value) {
+	if (!p_psg->getter) {
+		return true; //return true but do nothing
+	}
+
+	if (p_psg->index >= 0) {
+		Variant index = p_psg->index;
+		const Variant *arg[1] = { &index };
+		Callable::CallError ce;
+		r_value = p_object->callp(p_psg->getter, arg, 1, ce);
+
+	} else {
+		Callable::CallError ce;
+		if (p_psg->_getptr) {
+			r_value = p_psg->_getptr->call(p_object, nullptr, 0, ce);
+		} else {
+			r_value = p_object->callp(p_psg->getter, nullptr, 0, ce);
+		}
+	}
+	return true;
 }
 
 bool ClassDB::get_property(Object *p_object, const StringName &p_property, Variant &r_value) {
 	ERR_FAIL_NULL_V(p_object, false);
 
+	const ClassInfo::PropertyLookup *lookup = _get_property_lookup(p_object, p_property);
+	if (lookup && !lookup->getter_shadowed) {
+		return _get_property_with_setget(p_object, lookup->setget, r_value);
+	}
+
 	ClassInfo *type = classes.getptr(p_object->get_class_name());
 	ClassInfo *check = type;
 	while (check) {
 		const PropertySetGet *psg = check->property_setget.getptr(p_property);
 		if (psg) {
-			if (!psg->getter) {
-				return true; //return true but do nothing
-			}
-
-			if (psg->index >= 0) {
-				Variant index = psg->index;
-				const Variant *arg[1] = { &index };
-				Callable::CallError ce;
-				r_value = p_object->callp(psg->getter, arg, 1, ce);
-
-			} else {
-				Callable::CallError ce;
-				if (psg->_getptr) {
-					r_value = psg->_getptr->call(p_object, nullptr, 0, ce);
-				} else {
-					r_value = p_object->callp(psg->getter, nullptr, 0, ce);
-				}
-			}
-			return true;
+			return _get_property_with_setget(p_object, psg, r_value);
 		}
 
 		const int64_t *c = check->constant_map.getptr(p_property); //constants count
@@ -1455,6 +1513,7 @@ void ClassDB::_bind_method_custom(const StringName &p_class, MethodBind *p_metho
 #endif
 
 	type->method_map[p_method->get_name()] = p_method;
+	_invalidate_property_lookups();
 }
 
 MethodBind *ClassDB::_bind_vararg_method(MethodBind *p_bind, const StringName &p_name, const Vector<Variant> &p_default_args, bool p_compatibility) {
@@ -1481,6 +1540,7 @@ MethodBind *ClassDB::_bind_vararg_method(MethodBind *p_bind, const StringName &p
 		ERR_FAIL_V_MSG(nullptr, "Method already bound: " + instance_type + "::" + p_name + ".");
 	}
 	type->method_map[p_name] = bind;
+	_invalidate_property_lookups();
 #ifdef DEBUG_METHODS_ENABLED
 	// FIXME: <reduz> set_return_type is no longer in MethodBind, so I guess it should be moved to vararg method bind
 	//bind->set_return_type("Variant");
@@ -1539,6 +1599,7 @@ MethodBind *ClassDB::bind_methodfi(uint32_t p_flags, MethodBind *p_bind, bool p_
 		_bind_compatibility(type, p_bind);
 	} else {
 		type->method_map[mdname] = p_bind;
+		_invalidate_property_lookups();
 	}
 
 	Vector<Variant> defvals;
@@ -1786,6 +1847,7 @@ void ClassDB::register_extension_class(ObjectGDExtension *p_extension) {
 	c.reloadable = p_extension->reloadable;
 
 	classes[p_extension->class_name] = c;
+	_invalidate_property_lookups();
 }
 
 void ClassDB::unregister_extension_class(const StringName &p_class, bool p_free_method_binds) {
@@ -1797,6 +1859,7 @@ void ClassDB::unregister_extension_class(const StringName &p_class, bool p_free_
 		}
 	}
 	classes.erase(p_class);
+	_invalidate_property_lookups();
 }
 
 HashMap<StringName, ClassDB::NativeStruct> ClassDB::native_structs;
@@ -1824,6 +1887,9 @@ uint64_t ClassDB::get_native_struct_size(const StringName &p_name) {
 }
 
 RWLock ClassDB::lock;
+Mutex ClassDB::property_lookup_mutex;
+SafeNumeric<uint64_t> ClassDB::property_lookup_version(1);
+LocalVector<ClassDB::ClassInfo::PropertyLookupTable *> ClassDB::retired_property_lookups;
 
 void ClassDB::cleanup_defaults() {
 	default_values.clear();
@@ -1847,6 +1913,10 @@ void ClassDB::cleanup() {
 	}
 
 	classes.clear();
+	for (ClassInfo::PropertyLookupTable *table : retired_property_lookups) {
+		memdelete(table);
+	}
+	retired_property_lookups.reset();
 	resource_base_extensions.clear();
 	compat_classes.clear();
 	native_structs.clear();
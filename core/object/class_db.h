@@ -127,6 +127,37 @@ public:
 #endif
 		HashMap<StringName, PropertySetGet> property_setget;
 
+		// Setters and getters of this class and its ancestors, flattened on first use so
+		// property access doesn't walk the inheritance chain. A published table is never
+		// modified: when any class changes, a new one replaces it on the next lookup.
+		struct PropertyLookup {
+			const PropertySetGet *setget = nullptr;
+			bool getter_shadowed = false; // A constant, method or signal of a derived class takes precedence on get.
+		};
+		struct PropertyLookupTable {
+			uint64_t version = 0;
+			HashMap<StringName, PropertyLookup> lookup;
+		};
+		struct PropertyLookupTablePtr {
+			std::atomic<PropertyLookupTable *> table = { nullptr };
+
+			// Tables are built on demand, so copies start without one.
+			PropertyLookupTablePtr() {}
+			PropertyLookupTablePtr(const PropertyLookupTablePtr &p_other) {}
+			PropertyLookupTablePtr &operator=(const PropertyLookupTablePtr &p_other) {
+				reset();
+				return *this;
+			}
+			void reset() {
+				PropertyLookupTable *old_table = table.exchange(nullptr, std::memory_order_acq_rel);
+				if (old_table) {
+					memdelete(old_table);
+				}
+			}
+			~PropertyLookupTablePtr() { reset(); }
+		};
+		PropertyLookupTablePtr property_lookup;
+
 		StringName inherits;
 		StringName name;
 		bool disabled = false;
@@ -146,6 +177,15 @@ public:
 
 	static RWLock lock;
 	static HashMap<StringName, ClassInfo> classes;
+
+	static Mutex property_lookup_mutex;
+	static SafeNumeric<uint64_t> property_lookup_version;
+	// Replaced tables may still be read by other threads, so they are only freed on cleanup.
+	static LocalVector<ClassInfo::PropertyLookupTable *> retired_property_lookups;
+	_FORCE_INLINE_ static void _invalidate_property_lookups() { property_lookup_version.increment(); }
+	static const ClassInfo::PropertyLookupTable *_build_property_lookup(ClassInfo *p_type);
+	static const ClassInfo::PropertyLookup *_get_property_lookup(Object *p_object, const StringName &p_property);
+	static bool _get_property_with_setget(Object *p_object, const PropertySetGet *p_psg, Variant &r_value);
 	static HashMap<StringName, StringName> resource_base_extensions;
 	static HashMap<StringName, StringName> compat_classes;
 
@@ -1071,6 +1071,16 @@ Error Object::_emit_signal(const Variant **p_args, int p_argcount, Callable::Cal
 	return emit_signalp(signal, args, argc);
 }
 
+void Object::_invalidate_signal_snapshot(SignalData *p_signal) {
+	// Released outside of the lock, as freeing bound arguments may run arbitrary code.
+	Vector<Connection> previous;
+	_signal_snapshot_lock.lock();
+	previous = p_signal->emit_connections;
+	p_signal->emit_connections.clear();
+	p_signal->emit_connections_dirty = true;
+	_signal_snapshot_lock.unlock();
+}
+
 Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int p_argcount) {
 	if (_block_signals) {
 		return ERR_CANT_ACQUIRE_RESOURCE; //no emit, signals blocked
@@ -1094,16 +1104,21 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	List<_ObjectSignalDisconnectData> disconnect_data;
 
 	// Ensure that disconnecting the signal or even deleting the object
-	// will not affect the signal calling.
-	LocalVector<Connection> slot_conns;
-	slot_conns.resize(s->slot_map.size());
-	{
-		uint32_t idx = 0;
+	// will not affect the signal calling. Holding a reference keeps the snapshot
+	// alive, while changes made during emission build a new one.
+	Vector<Connection> slot_conns;
+	_signal_snapshot_lock.lock();
+	// The snapshot is only rebuilt after connections changed, so repeated emissions don't allocate.
+	if (unlikely(s->emit_connections_dirty)) {
+		s->emit_connections.resize(s->slot_map.size());
+		Connection *w = s->emit_connections.ptrw();
 		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-			slot_conns[idx++] = slot_kv.value.conn;
+			*w++ = slot_kv.value.conn;
 		}
-		DEV_ASSERT(idx == s->slot_map.size());
+		s->emit_connections_dirty = false;
 	}
+	slot_conns = s->emit_connections;
+	_signal_snapshot_lock.unlock();
 
 	OBJ_DEBUG_LOCK
 
@@ -1377,6 +1392,7 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*target.get_base_comparator()] = slot;
+	_invalidate_signal_snapshot(s);
 
 	return OK;
 }
@@ -1436,6 +1452,7 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	}
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	_invalidate_signal_snapshot(s); // Don't keep disconnected callables alive.
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
@@ -2058,9 +2075,13 @@ void postinitialize_handler(Object *p_object) {
 void ObjectDB::debug_objects(DebugFunc p_func) {
 	spin_lock.lock();
 
-	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object);
+	for (uint32_t i = 0, count = slot_count.get(); i < slot_max && count != 0; i++) {
+		ObjectSlot &object_slot = _get_slot(i);
+		if (object_slot.id.load(std::memory_order_acquire)) {
+			Object *object = object_slot.object.load(std::memory_order_acquire);
+			if (object) {
+				p_func(object);
+			}
 			count--;
 		}
 	}
@@ -2111,45 +2132,80 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 }
 
 SpinLock ObjectDB::spin_lock;
-uint32_t ObjectDB::slot_count = 0;
+std::atomic<ObjectDB::ObjectSlot *> ObjectDB::object_pages[OBJECTDB_PAGE_MAX_COUNT] = {};
 uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
-uint64_t ObjectDB::validator_counter = 0;
+uint32_t ObjectDB::free_list_head = UINT32_MAX;
+SafeNumeric<uint32_t> ObjectDB::slot_count;
+SafeNumeric<uint64_t> ObjectDB::validator_counter;
+thread_local ObjectDB::ThreadCache ObjectDB::thread_cache;
+
+ObjectDB::ThreadCache::~ThreadCache() {
+	// Give the cached slots back when the thread exits, unless the pages are already gone.
+	if (count && object_pages[0].load(std::memory_order_acquire)) {
+		_flush_thread_cache(*this, count);
+	}
+}
 
 int ObjectDB::get_object_count() {
-	return slot_count;
+	return slot_count.get();
 }
 
-ObjectID ObjectDB::add_instance(Object *p_object) {
+void ObjectDB::_refill_thread_cache(ThreadCache &p_cache) {
+	const uint32_t batch = OBJECTDB_THREAD_CACHE_SIZE / 2;
+
 	spin_lock.lock();
-	if (unlikely(slot_count == slot_max)) {
-		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_ref_counted = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+	while (p_cache.count < batch && free_list_head != UINT32_MAX) {
+		uint32_t slot = free_list_head;
+		free_list_head = _get_slot(slot).next_free;
+		p_cache.free_slots[p_cache.count++] = slot;
+	}
+
+	if (p_cache.count == 0) {
+		// No released slots, take new ones. They are pushed backwards so the lowest is used first.
+		CRASH_COND(slot_max + batch > (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
+
+		uint32_t page = slot_max >> OBJECTDB_PAGE_BITS;
+		if (!object_pages[page].load(std::memory_order_relaxed)) {
+			object_pages[page].store(memnew_arr(ObjectSlot, OBJECTDB_PAGE_SIZE), std::memory_order_release);
 		}
-		slot_max = new_slot_max;
+		for (uint32_t i = 0; i < batch; i++) {
+			p_cache.free_slots[p_cache.count++] = slot_max + batch - 1 - i;
+		}
+		slot_max += batch;
 	}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
-		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
+	spin_lock.unlock();
+}
+
+void ObjectDB::_flush_thread_cache(ThreadCache &p_cache, uint32_t p_count) {
+	spin_lock.lock();
+
+	for (uint32_t i = 0; i < p_count; i++) {
+		uint32_t slot = p_cache.free_slots[--p_cache.count];
+		_get_slot(slot).next_free = free_list_head;
+		free_list_head = slot;
 	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_ref_counted = p_object->is_ref_counted();
-	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
-	if (unlikely(validator_counter == 0)) {
-		validator_counter = 1;
+
+	spin_lock.unlock();
+}
+
+ObjectID ObjectDB::add_instance(Object *p_object) {
+	ThreadCache &cache = thread_cache;
+	if (unlikely(cache.count == 0)) {
+		_refill_thread_cache(cache);
+	}
+
+	uint32_t slot = cache.free_slots[--cache.count];
+	ObjectSlot &object_slot = _get_slot(slot);
+	ERR_FAIL_COND_V(object_slot.id.load(std::memory_order_relaxed) != 0, ObjectID());
+
+	uint64_t validator = validator_counter.increment() & OBJECTDB_VALIDATOR_MASK;
+	if (unlikely(validator == 0)) {
+		validator = validator_counter.increment() & OBJECTDB_VALIDATOR_MASK;
 	}
-	object_slots[slot].validator = validator_counter;
 
-	uint64_t id = validator_counter;
+	uint64_t id = validator;
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
 	id |= uint64_t(slot);
 
@@ -2157,9 +2213,11 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 		id |= OBJECTDB_REFERENCE_BIT;
 	}
 
-	slot_count++;
+	// Publish the object before the ID, lookups only read the object once the ID matches.
+	object_slot.object.store(p_object, std::memory_order_release);
+	object_slot.id.store(id, std::memory_order_release);
 
-	spin_lock.unlock();
+	slot_count.increment();
 
 	return ObjectID(id);
 }
@@ -2167,34 +2225,28 @@ ObjectID ObjectDB::add_instance(Object *p_object) {
 void ObjectDB::remove_instance(Object *p_object) {
 	uint64_t t = p_object->get_instance_id();
 	uint32_t slot = t & OBJECTDB_SLOT_MAX_COUNT_MASK; //slot is always valid on valid object
-
-	spin_lock.lock();
-
-#ifdef DEBUG_ENABLED
-
-	if (object_slots[slot].object != p_object) {
-		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
-	}
-	{
-		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
-			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
-		}
+	ObjectSlot *page = object_pages[slot >> OBJECTDB_PAGE_BITS].load(std::memory_order_acquire);
+	if (unlikely(!page)) {
+		return; // Freed after ObjectDB was cleaned up.
 	}
+	ObjectSlot &object_slot = page[slot & OBJECTDB_PAGE_MASK];
 
+#ifdef DEBUG_ENABLED
+	ERR_FAIL_COND(object_slot.object.load(std::memory_order_relaxed) != p_object);
+	ERR_FAIL_COND(object_slot.id.load(std::memory_order_relaxed) != t);
 #endif
-	//decrease slot count
-	slot_count--;
-	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
+
 	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_ref_counted = false;
-	object_slots[slot].object = nullptr;
+	object_slot.id.store(0, std::memory_order_relaxed);
+	object_slot.object.store(nullptr, std::memory_order_release);
 
-	spin_lock.unlock();
+	slot_count.decrement();
+
+	ThreadCache &cache = thread_cache;
+	if (unlikely(cache.count == OBJECTDB_THREAD_CACHE_SIZE)) {
+		_flush_thread_cache(cache, OBJECTDB_THREAD_CACHE_SIZE / 2);
+	}
+	cache.free_slots[cache.count++] = slot;
 }
 
 void ObjectDB::setup() {
@@ -2202,7 +2254,7 @@ void ObjectDB::setup() {
 }
 
 void ObjectDB::cleanup() {
-	if (slot_count > 0) {
+	if (slot_count.get() > 0) {
 		spin_lock.lock();
 
 		WARN_PRINT("ObjectDB instances leaked at exit (run with --verbose for details).");
@@ -2214,9 +2266,10 @@ void ObjectDB::cleanup() {
 			MethodBind *resource_get_path = ClassDB::get_method("Resource", "get_path");
 			Callable::CallError call_error;
 
-			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
+			for (uint32_t i = 0, count = slot_count.get(); i < slot_max && count != 0; i++) {
+				uint64_t id = _get_slot(i).id.load(std::memory_order_acquire);
+				if (id) {
+					Object *obj = _get_slot(i).object.load(std::memory_order_acquire);
 
 					String extra_info;
 					if (obj->is_class("Node")) {
@@ -2226,7 +2279,6 @@ void ObjectDB::cleanup() {
 						extra_info = " - Resource path: " + String(resource_get_path->call(obj, nullptr, 0, call_error));
 					}
 
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_VALIDATOR_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + itos(id) + extra_info);
 
 					count--;
@@ -2237,7 +2289,15 @@ void ObjectDB::cleanup() {
 		spin_lock.unlock();
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	spin_lock.lock();
+	for (uint32_t i = 0; i < OBJECTDB_PAGE_MAX_COUNT; i++) {
+		ObjectSlot *page = object_pages[i].exchange(nullptr, std::memory_order_acq_rel);
+		if (page) {
+			memdelete_arr(page);
+		}
 	}
+	slot_max = 0;
+	free_list_head = UINT32_MAX;
+	thread_cache.count = 0;
+	spin_lock.unlock();
 }
@@ -615,10 +615,17 @@ private:
 
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+
+		// Immutable snapshot of the connections, shared by emissions until slot_map changes.
+		Vector<Connection> emit_connections;
+		bool emit_connections_dirty = true;
 	};
 
 	HashMap<StringName, SignalData> signal_map;
 	List<Connection> connections;
+	// Protects the emission snapshots, which are rebuilt by whichever thread emits first.
+	SpinLock _signal_snapshot_lock;
+	void _invalidate_signal_snapshot(SignalData *p_signal);
 #ifdef DEBUG_ENABLED
 	SafeRefCount _lock_index;
 #endif
@@ -999,24 +1006,47 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_BITS 24
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
+#define OBJECTDB_PAGE_BITS 12
+#define OBJECTDB_PAGE_SIZE (1 << OBJECTDB_PAGE_BITS)
+#define OBJECTDB_PAGE_MASK (OBJECTDB_PAGE_SIZE - 1)
+#define OBJECTDB_PAGE_MAX_COUNT (1 << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_PAGE_BITS))
+#define OBJECTDB_THREAD_CACHE_SIZE 64
+
+	// Slots are allocated in pages which never move, so lookups can read them without locking.
+	// A slot holds the full ID of its object while in use, and zero while free.
+	struct ObjectSlot {
+		std::atomic<uint64_t> id{ 0 };
+		std::atomic<Object *> object{ nullptr };
+		uint32_t next_free = 0;
+	};
+
+	// Free slots are handed out from a small per-thread cache, so creating and freeing objects
+	// only needs to take the lock to exchange batches of slots with the shared free list.
+	struct ThreadCache {
+		uint32_t free_slots[OBJECTDB_THREAD_CACHE_SIZE];
+		uint32_t count = 0;
 
-	struct ObjectSlot { // 128 bits per slot.
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_ref_counted : 1;
-		Object *object = nullptr;
+		~ThreadCache();
 	};
 
-	static SpinLock spin_lock;
-	static uint32_t slot_count;
+	static SpinLock spin_lock; // Protects the shared free list and page allocation.
+	static std::atomic<ObjectSlot *> object_pages[OBJECTDB_PAGE_MAX_COUNT];
 	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
-	static uint64_t validator_counter;
+	static uint32_t free_list_head;
+	static SafeNumeric<uint32_t> slot_count;
+	static SafeNumeric<uint64_t> validator_counter;
+	static thread_local ThreadCache thread_cache;
 
 	friend class Object;
 	friend void unregister_core_types();
 	static void cleanup();
 
+	_ALWAYS_INLINE_ static ObjectSlot &_get_slot(uint32_t p_slot) {
+		return object_pages[p_slot >> OBJECTDB_PAGE_BITS].load(std::memory_order_acquire)[p_slot & OBJECTDB_PAGE_MASK];
+	}
+	static void _refill_thread_cache(ThreadCache &p_cache);
+	static void _flush_thread_cache(ThreadCache &p_cache, uint32_t p_count);
+
 	static ObjectID add_instance(Object *p_object);
 	static void remove_instance(Object *p_object);
 
@@ -1028,22 +1058,28 @@ public:
 
 	_ALWAYS_INLINE_ static Object *get_instance(ObjectID p_instance_id) {
 		uint64_t id = p_instance_id;
+		if (unlikely(id == 0)) {
+			// Free and half-initialized slots store an ID of 0, so it must never be looked up.
+			return nullptr;
+		}
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
 
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); // This should never happen unless RID is corrupted.
-
-		spin_lock.lock();
-
-		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
+		ObjectSlot *page = object_pages[slot >> OBJECTDB_PAGE_BITS].load(std::memory_order_acquire);
+		if (unlikely(page == nullptr)) {
+			return nullptr; // Stale or made up ID, pointing past the allocated slots.
+		}
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		ObjectSlot &object_slot = page[slot & OBJECTDB_PAGE_MASK];
+		if (unlikely(object_slot.id.load(std::memory_order_acquire) != id)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = object_slot.object.load(std::memory_order_acquire);
 
-		spin_lock.unlock();
+		// The object may have been removed (and the slot reused) while reading it.
+		if (unlikely(object_slot.id.load(std::memory_order_acquire) != id)) {
+			return nullptr;
+		}
 
 		return object;
 	}
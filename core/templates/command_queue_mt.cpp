@@ -71,6 +71,7 @@ CommandQueueMT::SyncSemaphore *CommandQueueMT::_alloc_sync_sem() {
 }
 
 CommandQueueMT::CommandQueueMT(bool p_sync) {
+	command_mem = memnew(LocalVector<uint8_t>);
 	if (p_sync) {
 		sync = memnew(Semaphore);
 	}
@@ -80,4 +81,8 @@ CommandQueueMT::~CommandQueueMT() {
 	if (sync) {
 		memdelete(sync);
 	}
+	memdelete(command_mem);
+	for (LocalVector<uint8_t> *mem : spare_command_mem) {
+		memdelete(mem);
+	}
 }
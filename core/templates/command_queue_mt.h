@@ -336,19 +336,24 @@ class CommandQueueMT {
 		SYNC_SEMAPHORES = 8
 	};
 
-	LocalVector<uint8_t> command_mem;
+	// Commands are pushed to the write buffer while buffers swapped out by flushes are being
+	// executed, so pushing only has to wait for a buffer swap, not for the execution of pending
+	// commands. Executed buffers are kept as spares, so their capacity survives the swaps.
+	LocalVector<uint8_t> *command_mem = nullptr;
+	LocalVector<LocalVector<uint8_t> *> spare_command_mem;
 	SyncSemaphore sync_sems[SYNC_SEMAPHORES];
 	Mutex mutex;
+	Mutex flush_mutex;
 	Semaphore *sync = nullptr;
 
 	template <class T>
 	T *allocate() {
 		// alloc size is size+T+safeguard
 		uint32_t alloc_size = ((sizeof(T) + 8 - 1) & ~(8 - 1));
-		uint64_t size = command_mem.size();
-		command_mem.resize(size + alloc_size + 8);
-		*(uint64_t *)&command_mem[size] = alloc_size;
-		T *cmd = memnew_placement(&command_mem[size + 8], T);
+		uint64_t size = command_mem->size();
+		command_mem->resize(size + alloc_size + 8);
+		*(uint64_t *)&(*command_mem)[size] = alloc_size;
+		T *cmd = memnew_placement(&(*command_mem)[size + 8], T);
 		return cmd;
 	}
 
@@ -359,16 +364,14 @@ class CommandQueueMT {
 		return ret;
 	}
 
-	void _flush() {
-		lock();
-
+	void _execute(LocalVector<uint8_t> &p_command_mem) {
 		uint64_t read_ptr = 0;
-		uint64_t limit = command_mem.size();
+		uint64_t limit = p_command_mem.size();
 
 		while (read_ptr < limit) {
-			uint64_t size = *(uint64_t *)&command_mem[read_ptr];
+			uint64_t size = *(uint64_t *)&p_command_mem[read_ptr];
 			read_ptr += 8;
-			CommandBase *cmd = reinterpret_cast<CommandBase *>(&command_mem[read_ptr]);
+			CommandBase *cmd = reinterpret_cast<CommandBase *>(&p_command_mem[read_ptr]);
 
 			cmd->call(); //execute the function
 			cmd->post(); //release in case it needs sync/ret
@@ -377,7 +380,33 @@ class CommandQueueMT {
 			read_ptr += size;
 		}
 
-		command_mem.clear();
+		p_command_mem.clear(); // Keeps the allocation for the next swap.
+	}
+
+	void _flush() {
+		// Keeps concurrent flushes ordered. The mutex is recursive, so a flush requested by a command
+		// being executed swaps out and runs what was pushed meanwhile, while the outer flush still
+		// owns the buffer it is executing.
+		MutexLock flush_lock(flush_mutex);
+
+		lock();
+		if (command_mem->is_empty()) {
+			unlock();
+			return;
+		}
+		LocalVector<uint8_t> *flush_mem = command_mem;
+		if (spare_command_mem.is_empty()) {
+			command_mem = memnew(LocalVector<uint8_t>);
+		} else {
+			command_mem = spare_command_mem[spare_command_mem.size() - 1];
+			spare_command_mem.resize(spare_command_mem.size() - 1);
+		}
+		unlock();
+
+		_execute(*flush_mem);
+
+		lock();
+		spare_command_mem.push_back(flush_mem);
 		unlock();
 	}
 
@@ -400,7 +429,7 @@ public:
 	SPACE_SEP_LIST(DECL_PUSH_AND_SYNC, 15)
 
 	_FORCE_INLINE_ void flush_if_pending() {
-		if (unlikely(command_mem.size() > 0)) {
+		if (unlikely(command_mem->size() > 0)) {
 			_flush();
 		}
 	}
@@ -287,6 +287,11 @@ bool ResourceImporterScene::get_option_visibility(const String &p_path, const St
 		return false;
 	}
 
+	if (p_option.begins_with("meshes/hlod/") && p_option != "meshes/hlod/enabled" && !bool(p_options["meshes/hlod/enabled"])) {
+		// Only display the HLOD settings when proxy generation is enabled.
+		return false;
+	}
+
 	for (int i = 0; i < post_importer_plugins.size(); i++) {
 		Variant ret = post_importer_plugins.write[i]->get_option_visibility(p_path, animation_importer, p_option, p_options);
 		if (ret.get_type() == Variant::BOOL) {
@@ -1937,6 +1942,11 @@ void ResourceImporterScene::get_import_options(const String &p_path, List<Import
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/create_shadow_meshes"), true));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::INT, "meshes/light_baking", PROPERTY_HINT_ENUM, "Disabled,Static (VoxelGI/SDFGI),Static Lightmaps (VoxelGI/SDFGI/LightmapGI),Dynamic (VoxelGI only)", PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_UPDATE_ALL_IF_MODIFIED), 1));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "meshes/lightmap_texel_size", PROPERTY_HINT_RANGE, "0.001,100,0.001"), 0.2));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/hlod/enabled", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_UPDATE_ALL_IF_MODIFIED), false));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "meshes/hlod/cell_size", PROPERTY_HINT_RANGE, "1,1024,0.1,or_greater,suffix:m"), 64.0));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "meshes/hlod/distance", PROPERTY_HINT_RANGE, "0,4096,0.1,or_greater,suffix:m"), 150.0));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "meshes/hlod/fade_margin", PROPERTY_HINT_RANGE, "0,256,0.1,or_greater,suffix:m"), 0.0));
+	r_options->push_back(ImportOption(PropertyInfo(Variant::FLOAT, "meshes/hlod/detail_ratio", PROPERTY_HINT_RANGE, "0.01,1,0.01"), 0.25));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "meshes/force_disable_compression"), false));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "skins/use_named_skins"), true));
 	r_options->push_back(ImportOption(PropertyInfo(Variant::BOOL, "animation/import"), true));
@@ -2191,6 +2201,175 @@ Node *ResourceImporterScene::_generate_meshes(Node *p_node, const Dictionary &p_
 	return p_node;
 }
 
+static bool _has_visual_instance_descendant(Node *p_node) {
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		Node *child = p_node->get_child(i);
+		if (Object::cast_to<VisualInstance3D>(child) || _has_visual_instance_descendant(child)) {
+			return true;
+		}
+	}
+	return false;
+}
+
+static bool _is_hlod_candidate(MeshInstance3D *p_mesh_node) {
+	if (!p_mesh_node->is_visible() || p_mesh_node->get_skin().is_valid() || !p_mesh_node->get_visibility_parent().is_empty()) {
+		return false;
+	}
+	if (p_mesh_node->get_visibility_range_begin() > 0.0 || p_mesh_node->get_visibility_range_end() > 0.0) {
+		// Respect visibility ranges that were set up by hand.
+		return false;
+	}
+
+	Ref<ArrayMesh> mesh = p_mesh_node->get_mesh();
+	if (mesh.is_null() || mesh->get_blend_shape_count() > 0) {
+		return false;
+	}
+	for (int i = 0; i < mesh->get_surface_count(); i++) {
+		if (mesh->surface_get_primitive_type(i) != Mesh::PRIMITIVE_TRIANGLES || (mesh->surface_get_format(i) & RS::ARRAY_FORMAT_BONES)) {
+			return false;
+		}
+	}
+
+	// The visibility parent is inherited by descendants, so a child that is not part of the proxy would be hidden along with this node.
+	return !_has_visual_instance_descendant(p_mesh_node);
+}
+
+void ResourceImporterScene::_collect_hlod_sources(Node *p_node, const Transform3D &p_parent_xform, float p_cell_size, HashMap<Vector3i, LocalVector<HLODSource>> &r_cells) {
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		Node3D *child = Object::cast_to<Node3D>(p_node->get_child(i));
+		if (!child) {
+			// Non-spatial nodes break the transform chain, so their subtree can't be placed relative to the scene root.
+			continue;
+		}
+
+		Transform3D xform = p_parent_xform * child->get_transform();
+		MeshInstance3D *mesh_node = Object::cast_to<MeshInstance3D>(child);
+		if (mesh_node && _is_hlod_candidate(mesh_node)) {
+			AABB aabb = xform.xform(mesh_node->get_mesh()->get_aabb());
+			Vector3 cell = (aabb.get_center() / p_cell_size).floor();
+			HLODSource source;
+			source.mesh_node = mesh_node;
+			source.xform = xform;
+			r_cells[Vector3i(cell)].push_back(source);
+		}
+
+		_collect_hlod_sources(child, xform, p_cell_size, r_cells);
+	}
+}
+
+static Array _simplify_hlod_surface(const Array &p_arrays, float p_detail_ratio) {
+	const Vector<Vector3> vertices = p_arrays[RS::ARRAY_VERTEX];
+	const PackedInt32Array indices = p_arrays[RS::ARRAY_INDEX];
+	const int target_index_count = MAX(3, int(indices.size() * p_detail_ratio) / 3 * 3);
+	if (!SurfaceTool::simplify_func || target_index_count >= indices.size()) {
+		return p_arrays;
+	}
+
+	LocalVector<float> positions;
+	positions.resize(vertices.size() * 3);
+	for (int i = 0; i < vertices.size(); i++) {
+		positions[i * 3 + 0] = vertices[i].x;
+		positions[i * 3 + 1] = vertices[i].y;
+		positions[i * 3 + 2] = vertices[i].z;
+	}
+
+	PackedInt32Array simplified;
+	simplified.resize(indices.size());
+	float error = 0.0f;
+	// The error bound is relative to the mesh extents, so 1.0 lets the target index count alone decide.
+	const size_t index_count = SurfaceTool::simplify_func((unsigned int *)simplified.ptrw(), (const unsigned int *)indices.ptr(), indices.size(), positions.ptr(), vertices.size(), sizeof(float) * 3, target_index_count, 1.0f, 0, &error);
+	if (index_count == 0 || index_count >= (size_t)indices.size()) {
+		return p_arrays;
+	}
+	simplified.resize(index_count);
+
+	Array arrays = p_arrays.duplicate();
+	arrays[RS::ARRAY_INDEX] = simplified;
+
+	// Round-trip through the surface tool to drop the vertices that are no longer referenced.
+	Ref<SurfaceTool> st;
+	st.instantiate();
+	st->create_from_triangle_arrays(arrays);
+	st->deindex();
+	st->index();
+	return st->commit_to_arrays();
+}
+
+void ResourceImporterScene::_generate_hlod_proxies(Node *p_scene, float p_cell_size, float p_distance, float p_fade_margin, float p_detail_ratio, bool p_generate_lods) {
+	HashMap<Vector3i, LocalVector<HLODSource>> cells;
+	_collect_hlod_sources(p_scene, Transform3D(), p_cell_size, cells);
+
+	uint32_t merged_instances = 0;
+	uint32_t proxy_count = 0;
+	uint64_t source_triangles = 0;
+	uint64_t proxy_triangles = 0;
+
+	for (const KeyValue<Vector3i, LocalVector<HLODSource>> &E : cells) {
+		if (E.value.size() < 2) {
+			continue; // Nothing to gain from a proxy of a single mesh.
+		}
+
+		// One merged surface per material, in order of first appearance.
+		LocalVector<Ref<SurfaceTool>> surface_tools;
+		HashMap<Ref<Material>, uint32_t> material_surfaces;
+
+		for (const HLODSource &source : E.value) {
+			Ref<ArrayMesh> mesh = source.mesh_node->get_mesh();
+			for (int i = 0; i < mesh->get_surface_count(); i++) {
+				Ref<Material> material = source.mesh_node->get_active_material(i);
+
+				uint32_t *surface_index = material_surfaces.getptr(material);
+				if (!surface_index) {
+					Ref<SurfaceTool> st;
+					st.instantiate();
+					st->set_material(material);
+					surface_index = &material_surfaces.insert(material, surface_tools.size())->value;
+					surface_tools.push_back(st);
+				}
+				surface_tools[*surface_index]->append_from(mesh, i, source.xform);
+			}
+		}
+
+		Ref<ImporterMesh> importer_mesh;
+		importer_mesh.instantiate();
+		for (const Ref<SurfaceTool> &st : surface_tools) {
+			// Proxies are only drawn beyond the HLOD distance, where the full detail of their sources is wasted.
+			st->index();
+			Array arrays = st->commit_to_arrays();
+			source_triangles += PackedInt32Array(arrays[RS::ARRAY_INDEX]).size() / 3;
+			arrays = _simplify_hlod_surface(arrays, p_detail_ratio);
+			proxy_triangles += PackedInt32Array(arrays[RS::ARRAY_INDEX]).size() / 3;
+			importer_mesh->add_surface(Mesh::PRIMITIVE_TRIANGLES, arrays, Array(), Dictionary(), st->get_material());
+		}
+		if (p_generate_lods) {
+			// The proxy is only ever seen from far away, so the coarser LODs do most of the work here.
+			importer_mesh->generate_lods(60.0f, 25.0f, Array());
+		}
+
+		MeshInstance3D *proxy = memnew(MeshInstance3D);
+		proxy->set_name(vformat("HLOD_%d_%d_%d", E.key.x, E.key.y, E.key.z));
+		proxy->set_mesh(importer_mesh->get_mesh());
+		proxy->set_gi_mode(GeometryInstance3D::GI_MODE_DISABLED);
+		proxy->set_visibility_range_begin(p_distance);
+		if (p_fade_margin > 0.0) {
+			proxy->set_visibility_range_begin_margin(p_fade_margin);
+			proxy->set_visibility_range_fade_mode(GeometryInstance3D::VISIBILITY_RANGE_FADE_DEPENDENCIES);
+		}
+		p_scene->add_child(proxy, true);
+		proxy->set_owner(p_scene);
+
+		// Sources are only drawn while the proxy is out of its visibility range, i.e. up close.
+		for (const HLODSource &source : E.value) {
+			source.mesh_node->set_visibility_parent(source.mesh_node->get_path_to(proxy));
+		}
+
+		merged_instances += E.value.size();
+		proxy_count++;
+	}
+
+	print_verbose(vformat("HLOD: Merged %d mesh instances into %d proxies (%d cells), simplified from %d to %d triangles.", merged_instances, proxy_count, cells.size(), source_triangles, proxy_triangles));
+}
+
 void ResourceImporterScene::_add_shapes(Node *p_node, const Vector<Ref<Shape3D>> &p_shapes) {
 	for (const Ref<Shape3D> &E : p_shapes) {
 		CollisionShape3D *cshape = memnew(CollisionShape3D);
@@ -2570,6 +2749,12 @@ Error ResourceImporterScene::import(const String &p_source_file, const String &p
 	}
 	scene = _generate_meshes(scene, mesh_data, gen_lods, create_shadow_meshes, LightBakeMode(light_bake_mode), lightmap_texel_size, src_lightmap_cache, mesh_lightmap_caches);
 
+	if (bool(p_options["meshes/hlod/enabled"])) {
+		float hlod_cell_size = MAX(0.001, float(p_options["meshes/hlod/cell_size"]));
+		float hlod_detail_ratio = CLAMP(float(p_options["meshes/hlod/detail_ratio"]), 0.01, 1.0);
+		_generate_hlod_proxies(scene, hlod_cell_size, p_options["meshes/hlod/distance"], p_options["meshes/hlod/fade_margin"], hlod_detail_ratio, gen_lods);
+	}
+
 	if (mesh_lightmap_caches.size()) {
 		Ref<FileAccess> f = FileAccess::open(p_source_file + ".unwrap_cache", FileAccess::WRITE);
 		if (f.is_valid()) {
@@ -46,6 +46,7 @@
 
 class Material;
 class AnimationPlayer;
+class MeshInstance3D;
 
 class ImporterMesh;
 class EditorSceneFormatImporter : public RefCounted {
@@ -159,6 +160,8 @@ VARIANT_ENUM_CAST(EditorScenePostImportPlugin::InternalImportCategory)
 class ResourceImporterScene : public ResourceImporter {
 	GDCLASS(ResourceImporterScene, ResourceImporter);
 
+	friend class TestResourceImporterSceneAccessor;
+
 	static Vector<Ref<EditorSceneFormatImporter>> importers;
 	static Vector<Ref<EditorScenePostImportPlugin>> post_importer_plugins;
 
@@ -219,6 +222,14 @@ class ResourceImporterScene : public ResourceImporter {
 	Node *_generate_meshes(Node *p_node, const Dictionary &p_mesh_data, bool p_generate_lods, bool p_create_shadow_meshes, LightBakeMode p_light_bake_mode, float p_lightmap_texel_size, const Vector<uint8_t> &p_src_lightmap_cache, Vector<Vector<uint8_t>> &r_lightmap_caches);
 	void _add_shapes(Node *p_node, const Vector<Ref<Shape3D>> &p_shapes);
 
+	struct HLODSource {
+		MeshInstance3D *mesh_node = nullptr;
+		Transform3D xform; // Relative to the scene root.
+	};
+
+	static void _collect_hlod_sources(Node *p_node, const Transform3D &p_parent_xform, float p_cell_size, HashMap<Vector3i, LocalVector<HLODSource>> &r_cells);
+	static void _generate_hlod_proxies(Node *p_scene, float p_cell_size, float p_distance, float p_fade_margin, float p_detail_ratio, bool p_generate_lods);
+
 	enum AnimationImportTracks {
 		ANIMATION_IMPORT_TRACKS_IF_PRESENT,
 		ANIMATION_IMPORT_TRACKS_IF_PRESENT_FOR_ALL,
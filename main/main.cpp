@@ -473,6 +473,10 @@ void Main::print_help(const char *p_binary) {
 	OS::get_singleton()->print("  -d, --debug                       Debug (local stdout debugger).\n");
 	OS::get_singleton()->print("  -b, --breakpoints                 Breakpoint list as source::line comma-separated pairs, no spaces (use %%20 instead).\n");
 	OS::get_singleton()->print("  --profiling                       Enable profiling in the script debugger.\n");
+#ifdef MODULE_GDSCRIPT_ENABLED
+	OS::get_singleton()->print("  --gdscript-sampling-profile <file> Sample GDScript call stacks (also in release builds) and write them as collapsed stacks to <file> on exit.\n");
+	OS::get_singleton()->print("  --gdscript-sampling-interval <us> Interval between GDScript call stack samples, in microseconds (default is 1000).\n");
+#endif
 	OS::get_singleton()->print("  --gpu-profile                     Show a GPU profile of the tasks that took the most time during frame rendering.\n");
 	OS::get_singleton()->print("  --gpu-validation                  Enable graphics API validation layers for debugging.\n");
 #if DEBUG_ENABLED
@@ -2850,6 +2854,10 @@ bool Main::start() {
 				script = args[i + 1];
 			} else if (args[i] == "--main-loop") {
 				main_loop_type = args[i + 1];
+#ifdef MODULE_GDSCRIPT_ENABLED
+			} else if (args[i] == "--gdscript-sampling-profile" || args[i] == "--gdscript-sampling-interval") {
+				// Handled by the GDScript module, skip the value so it's not used as a positional argument.
+#endif
 #ifdef TOOLS_ENABLED
 			} else if (args[i] == "--doctool") {
 				doc_tool_path = args[i + 1];
@@ -3,6 +3,18 @@ def can_build(env, platform):
     return True
 
 
+def get_opts(platform):
+    from SCons.Variables import BoolVariable
+
+    return [
+        BoolVariable(
+            "gdscript_tier_up",
+            "Count GDScript function calls and hand hot functions to a registered second execution tier",
+            False,
+        ),
+    ]
+
+
 def configure(env):
     pass
 
@@ -35,6 +35,7 @@
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
 #include "gdscript_rpc_callable.h"
+#include "gdscript_sampling_profiler.h"
 #include "gdscript_warning.h"
 
 #ifdef TOOLS_ENABLED
@@ -1494,6 +1495,9 @@ void GDScript::clear(ClearData *p_clear_data) {
 		clear_data->functions.insert(E.value);
 	}
 	member_functions.clear();
+	notification_function = nullptr;
+	process_function = nullptr;
+	physics_process_function = nullptr;
 
 	for (KeyValue<StringName, MemberInfo> &E : member_indices) {
 		clear_data->scripts.insert(E.value.data_type.script_type_ref);
@@ -1930,6 +1934,23 @@ Variant GDScriptInstance::callp(const StringName &p_method, const Variant **p_ar
 
 		// Reset this back for the regular call.
 		sptr = script.ptr();
+	} else if (p_method == GDScriptLanguage::get_singleton()->strings._process) {
+		// Called on every processing node each frame, skip the lookup by name.
+		for (; sptr; sptr = sptr->_base) {
+			if (sptr->process_function) {
+				return sptr->process_function->call(this, p_args, p_argcount, r_error);
+			}
+		}
+		r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
+		return Variant();
+	} else if (p_method == GDScriptLanguage::get_singleton()->strings._physics_process) {
+		for (; sptr; sptr = sptr->_base) {
+			if (sptr->physics_process_function) {
+				return sptr->physics_process_function->call(this, p_args, p_argcount, r_error);
+			}
+		}
+		r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
+		return Variant();
 	}
 	while (sptr) {
 		HashMap<StringName, GDScriptFunction *>::Iterator E = sptr->member_functions.find(p_method);
@@ -1944,27 +1965,34 @@ Variant GDScriptInstance::callp(const StringName &p_method, const Variant **p_ar
 
 void GDScriptInstance::notification(int p_notification, bool p_reversed) {
 	//notification is not virtual, it gets called at ALL levels just like in C.
+	// This runs for every notification sent to every scripted object (including each process
+	// notification), so resolve the chain on the stack from the pointers cached at compile time.
+	int chain_size = 0;
+	for (GDScript *sptr = script.ptr(); sptr; sptr = sptr->_base) {
+		chain_size++;
+	}
+	GDScriptFunction **chain = (GDScriptFunction **)alloca(sizeof(GDScriptFunction *) * chain_size);
+	int function_count = 0;
+	for (GDScript *sptr = script.ptr(); sptr; sptr = sptr->_base) {
+		if (sptr->notification_function) {
+			chain[function_count++] = sptr->notification_function;
+		}
+	}
+
+	if (function_count == 0) {
+		return;
+	}
+
 	Variant value = p_notification;
 	const Variant *args[1] = { &value };
 
-	List<GDScript *> pl;
-	GDScript *sptr = script.ptr();
-	while (sptr) {
-		if (p_reversed) {
-			pl.push_back(sptr);
-		} else {
-			pl.push_front(sptr);
-		}
-		sptr = sptr->_base;
-	}
-	for (GDScript *sc : pl) {
-		HashMap<StringName, GDScriptFunction *>::Iterator E = sc->member_functions.find(GDScriptLanguage::get_singleton()->strings._notification);
-		if (E) {
-			Callable::CallError err;
-			E->value->call(this, args, 1, err);
-			if (err.error != Callable::CallError::CALL_OK) {
-				//print error about notification call
-			}
+	for (int i = 0; i < function_count; i++) {
+		// The chain goes from the most derived script to the base one, base goes first unless reversed.
+		GDScriptFunction *func = p_reversed ? chain[i] : chain[function_count - i - 1];
+		Callable::CallError err;
+		func->call(this, args, 1, err);
+		if (err.error != Callable::CallError::CALL_OK) {
+			//print error about notification call
 		}
 	}
 }
@@ -2106,6 +2134,8 @@ void GDScriptLanguage::thread_enter() {
 }
 
 void GDScriptLanguage::thread_exit() {
+	GDScriptSamplingProfiler::thread_exit();
+
 	// This thread may have been created before GDScript was up
 	// (which also means it can't have run any GDScript code at all).
 	if (!GDScript::func_ptrs_to_update_thread_local) {
@@ -2162,6 +2192,8 @@ void GDScriptLanguage::init() {
 
 	GDScript::func_ptrs_to_update_thread_local = &GDScript::func_ptrs_to_update_main_thread;
 
+	GDScriptSamplingProfiler::initialize();
+
 #ifdef TESTS_ENABLED
 	GDScriptTests::GDScriptTestRunner::handle_cmdline();
 #endif
@@ -2178,6 +2210,9 @@ String GDScriptLanguage::get_extension() const {
 void GDScriptLanguage::finish() {
 	_call_stack.free();
 
+	// Dump before functions are freed, so labels can still be resolved.
+	GDScriptSamplingProfiler::finalize();
+
 	// Clear the cache before parsing the script_list
 	GDScriptCache::clear();
 
@@ -2212,6 +2247,8 @@ void GDScriptLanguage::finish() {
 	script_list.clear();
 	function_list.clear();
 
+	GDScriptFunctionState::clear_stack_pool();
+
 	DEV_ASSERT(GDScript::func_ptrs_to_update_main_thread.rc == 1);
 }
 
@@ -2700,6 +2737,8 @@ GDScriptLanguage::GDScriptLanguage() {
 	strings._init = StaticCString::create("_init");
 	strings._static_init = StaticCString::create("_static_init");
 	strings._notification = StaticCString::create("_notification");
+	strings._process = StaticCString::create("_process");
+	strings._physics_process = StaticCString::create("_physics_process");
 	strings._set = StaticCString::create("_set");
 	strings._get = StaticCString::create("_get");
 	strings._get_property_list = StaticCString::create("_get_property_list");
@@ -169,6 +169,11 @@ class GDScript : public Script {
 	GDScriptFunction *implicit_ready = nullptr;
 	GDScriptFunction *static_initializer = nullptr;
 
+	// Direct pointers into member_functions for the callbacks sent to every processing node each frame.
+	GDScriptFunction *notification_function = nullptr;
+	GDScriptFunction *process_function = nullptr;
+	GDScriptFunction *physics_process_function = nullptr;
+
 	Error _static_init();
 
 	int subclass_count = 0;
@@ -504,6 +509,8 @@ public:
 		StringName _init;
 		StringName _static_init;
 		StringName _notification;
+		StringName _process;
+		StringName _physics_process;
 		StringName _set;
 		StringName _get;
 		StringName _get_property_list;
@@ -192,10 +192,14 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 			opcodes.write[temporaries[i].bytecode_indices[j]] = stack_index | (GDScriptFunction::ADDR_TYPE_STACK << GDScriptFunction::ADDR_BITS);
 		}
 		if (temporaries[i].type != Variant::NIL) {
-			function->temporary_slots[stack_index] = temporaries[i].type;
+			function->temporary_slots.push_back(Pair<int, Variant::Type>(stack_index, temporaries[i].type));
 		}
 	}
 
+	// Flattened so the call prologue can initialize typed temporaries without walking a hash map.
+	function->_temporary_slots_count = function->temporary_slots.size();
+	function->_temporary_slots_ptr = function->temporary_slots.ptr();
+
 	if (constant_map.size()) {
 		function->_constant_count = constant_map.size();
 		function->constants.resize(constant_map.size());
@@ -2418,6 +2418,15 @@ GDScriptFunction *GDScriptCompiler::_parse_function(Error &r_error, GDScript *p_
 
 	if (!is_implicit_initializer && !is_implicit_ready && !p_for_lambda) {
 		p_script->member_functions[func_name] = gd_function;
+
+		const GDScriptLanguage *language = GDScriptLanguage::get_singleton();
+		if (func_name == language->strings._notification) {
+			p_script->notification_function = gd_function;
+		} else if (func_name == language->strings._process) {
+			p_script->process_function = gd_function;
+		} else if (func_name == language->strings._physics_process) {
+			p_script->physics_process_function = gd_function;
+		}
 	}
 
 	memdelete(codegen.generator);
@@ -2631,6 +2640,9 @@ Error GDScriptCompiler::_prepare_compilation(GDScript *p_script, const GDScriptP
 	p_script->implicit_initializer = nullptr;
 	p_script->implicit_ready = nullptr;
 	p_script->static_initializer = nullptr;
+	p_script->notification_function = nullptr;
+	p_script->process_function = nullptr;
+	p_script->physics_process_function = nullptr;
 	p_script->rpc_config.clear();
 	p_script->lambda_info.clear();
 
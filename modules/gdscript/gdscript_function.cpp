@@ -31,6 +31,7 @@
 #include "gdscript_function.h"
 
 #include "gdscript.h"
+#include "gdscript_sampling_profiler.h"
 
 Variant GDScriptFunction::get_constant(int p_idx) const {
 	ERR_FAIL_INDEX_V(p_idx, constants.size(), "<errconst>");
@@ -42,6 +43,37 @@ StringName GDScriptFunction::get_global_name(int p_idx) const {
 	return global_names[p_idx];
 }
 
+#ifdef GDSCRIPT_TIER_UP_ENABLED
+GDScriptFunction::TierCompiler GDScriptFunction::tier_compiler = nullptr;
+uint32_t GDScriptFunction::tier_up_threshold = 1000;
+
+void GDScriptFunction::_tier_up() {
+	if (tier_compiler == nullptr) {
+		return;
+	}
+	tier_entry.store(tier_compiler(this), std::memory_order_release);
+}
+
+void GDScriptFunction::set_tier_compiler(TierCompiler p_compiler) {
+	// Functions that already tiered up keep the entry of the previous compiler.
+	tier_compiler = p_compiler;
+}
+
+GDScriptFunction::TierCompiler GDScriptFunction::get_tier_compiler() {
+	return tier_compiler;
+}
+
+void GDScriptFunction::set_tier_up_threshold(uint32_t p_calls) {
+	// Functions that were already called more often stay in the interpreter.
+	ERR_FAIL_COND(p_calls == 0);
+	tier_up_threshold = p_calls;
+}
+
+uint32_t GDScriptFunction::get_tier_up_threshold() {
+	return tier_up_threshold;
+}
+#endif // GDSCRIPT_TIER_UP_ENABLED
+
 struct _GDFKC {
 	int order = 0;
 	List<int> pos;
@@ -115,7 +147,15 @@ GDScriptFunction::GDScriptFunction() {
 }
 
 GDScriptFunction::~GDScriptFunction() {
-	get_script()->member_functions.erase(name);
+	GDScript *owner_script = get_script();
+	owner_script->member_functions.erase(name);
+	if (owner_script->notification_function == this) {
+		owner_script->notification_function = nullptr;
+	} else if (owner_script->process_function == this) {
+		owner_script->process_function = nullptr;
+	} else if (owner_script->physics_process_function == this) {
+		owner_script->physics_process_function = nullptr;
+	}
 
 	for (int i = 0; i < lambdas.size(); i++) {
 		memdelete(lambdas[i]);
@@ -126,6 +166,10 @@ GDScriptFunction::~GDScriptFunction() {
 	}
 	return_type.script_type_ref = Ref<Script>();
 
+	if (unlikely(GDScriptSamplingProfiler::is_tracking_functions())) {
+		GDScriptSamplingProfiler::function_freed(this);
+	}
+
 #ifdef DEBUG_ENABLED
 	MutexLock lock(GDScriptLanguage::get_singleton()->mutex);
 	GDScriptLanguage::get_singleton()->function_list.remove(&function_list);
@@ -246,9 +290,68 @@ Variant GDScriptFunctionState::resume(const Variant &p_arg) {
 #endif
 	}
 
+	// The stack values were either released by the VM or by `_clear_stack()` above, so the buffer can be reused.
+	state.stack_size = 0;
+	_release_stack(state.stack);
+
 	return ret;
 }
 
+SpinLock GDScriptFunctionState::stack_pool_lock;
+LocalVector<Vector<uint8_t>> GDScriptFunctionState::stack_pool[STACK_POOL_SIZE_CLASSES];
+bool GDScriptFunctionState::stack_pooling = true;
+
+Vector<uint8_t> GDScriptFunctionState::_acquire_stack(uint32_t p_size) {
+	Vector<uint8_t> stack;
+	uint32_t size_class = nearest_shift(p_size - 1);
+	if (stack_pooling && size_class < STACK_POOL_SIZE_CLASSES) {
+		stack_pool_lock.lock();
+		if (!stack_pool[size_class].is_empty()) {
+			uint32_t last = stack_pool[size_class].size() - 1;
+			stack = stack_pool[size_class][last];
+			stack_pool[size_class].resize(last);
+		}
+		stack_pool_lock.unlock();
+	}
+	// Sizes within the same class share the allocation size, so this doesn't reallocate a pooled buffer.
+	stack.resize(p_size);
+	return stack;
+}
+
+void GDScriptFunctionState::_release_stack(Vector<uint8_t> &p_stack) {
+	if (p_stack.is_empty()) {
+		return;
+	}
+	uint32_t size_class = nearest_shift(p_stack.size() - 1);
+	if (stack_pooling && size_class < STACK_POOL_SIZE_CLASSES) {
+		stack_pool_lock.lock();
+		if (stack_pool[size_class].size() < STACK_POOL_MAX_PER_CLASS) {
+			stack_pool[size_class].push_back(p_stack);
+		}
+		stack_pool_lock.unlock();
+	}
+	p_stack.clear();
+}
+
+void GDScriptFunctionState::clear_stack_pool() {
+	stack_pool_lock.lock();
+	for (int i = 0; i < STACK_POOL_SIZE_CLASSES; i++) {
+		stack_pool[i].reset();
+	}
+	stack_pool_lock.unlock();
+}
+
+void GDScriptFunctionState::set_stack_pooling_enabled(bool p_enabled) {
+	stack_pooling = p_enabled;
+	if (!p_enabled) {
+		clear_stack_pool();
+	}
+}
+
+bool GDScriptFunctionState::is_stack_pooling_enabled() {
+	return stack_pooling;
+}
+
 void GDScriptFunctionState::_clear_stack() {
 	if (state.stack_size) {
 		Variant *stack = (Variant *)state.stack.ptr();
@@ -35,8 +35,10 @@
 
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
+#include "core/os/spin_lock.h"
 #include "core/os/thread.h"
 #include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/pair.h"
 #include "core/templates/self_list.h"
 #include "core/variant/variant.h"
@@ -391,7 +393,7 @@ private:
 
 	SelfList<GDScriptFunction> function_list{ this };
 	mutable Variant nil;
-	HashMap<int, Variant::Type> temporary_slots;
+	Vector<Pair<int, Variant::Type>> temporary_slots;
 	List<StackDebug> stack_debug;
 
 	Vector<int> code;
@@ -429,6 +431,7 @@ private:
 	int _gds_utilities_count = 0;
 	int _methods_count = 0;
 	int _lambdas_count = 0;
+	int _temporary_slots_count = 0;
 
 	int *_code_ptr = nullptr;
 	const int *_default_arg_ptr = nullptr;
@@ -447,6 +450,7 @@ private:
 	const GDScriptUtilityFunctions::FunctionPtr *_gds_utilities_ptr = nullptr;
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
+	const Pair<int, Variant::Type> *_temporary_slots_ptr = nullptr;
 
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
@@ -480,6 +484,33 @@ private:
 public:
 	static constexpr int MAX_CALL_DEPTH = 2048; // Limit to try to avoid crash because of a stack overflow.
 
+#ifdef GDSCRIPT_TIER_UP_ENABLED
+	// Entry point of a function compiled by a second execution tier. It receives the arguments as
+	// passed by the caller, before type checks and conversions. Returning false deoptimizes: the
+	// entry must not have had any side effects, and the call then runs in the interpreter.
+	typedef bool (*TierEntry)(GDScriptFunction *p_function, GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err);
+	// Compiles a hot function for the second tier, or returns nullptr to keep it in the interpreter
+	// (e.g. when it isn't fully typed).
+	typedef TierEntry (*TierCompiler)(const GDScriptFunction *p_function);
+
+private:
+	static TierCompiler tier_compiler;
+	static uint32_t tier_up_threshold;
+
+	SafeNumeric<uint32_t> tier_call_count;
+	std::atomic<TierEntry> tier_entry = nullptr;
+
+	void _tier_up();
+
+public:
+	static void set_tier_compiler(TierCompiler p_compiler);
+	static TierCompiler get_tier_compiler();
+	static void set_tier_up_threshold(uint32_t p_calls);
+	static uint32_t get_tier_up_threshold();
+
+	_FORCE_INLINE_ bool is_tiered_up() const { return tier_entry.load(std::memory_order_acquire) != nullptr; }
+#endif // GDSCRIPT_TIER_UP_ENABLED
+
 	struct CallState {
 		GDScript *script = nullptr;
 		GDScriptInstance *instance = nullptr;
@@ -529,6 +560,17 @@ class GDScriptFunctionState : public RefCounted {
 	SelfList<GDScriptFunctionState> scripts_list;
 	SelfList<GDScriptFunctionState> instances_list;
 
+	// Stack buffers of finished coroutines are recycled, grouped by allocation size class,
+	// so that awaiting every frame doesn't hit the allocator.
+	static constexpr int STACK_POOL_SIZE_CLASSES = 20;
+	static constexpr uint32_t STACK_POOL_MAX_PER_CLASS = 64;
+	static SpinLock stack_pool_lock;
+	static LocalVector<Vector<uint8_t>> stack_pool[STACK_POOL_SIZE_CLASSES];
+	static bool stack_pooling; // When disabled, stacks are allocated and copied for every await, to measure the gain.
+
+	static Vector<uint8_t> _acquire_stack(uint32_t p_size);
+	static void _release_stack(Vector<uint8_t> &p_stack);
+
 protected:
 	static void _bind_methods();
 
@@ -539,6 +581,10 @@ public:
 	void _clear_stack();
 	void _clear_connections();
 
+	static void clear_stack_pool();
+	static void set_stack_pooling_enabled(bool p_enabled);
+	static bool is_stack_pooling_enabled();
+
 	GDScriptFunctionState();
 	~GDScriptFunctionState();
 };
@@ -0,0 +1,283 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "gdscript_sampling_profiler.h"
+
+#include "gdscript_function.h"
+
+#include "core/debugger/engine_debugger.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "core/templates/hashfuncs.h"
+
+SafeFlag GDScriptSamplingProfiler::active;
+SafeFlag GDScriptSamplingProfiler::tracking_functions;
+thread_local GDScriptSamplingProfiler::ThreadStack *GDScriptSamplingProfiler::thread_stack = nullptr;
+thread_local uint32_t GDScriptSamplingProfiler::thread_stack_generation = 0;
+SafeNumeric<uint32_t> GDScriptSamplingProfiler::stack_generation;
+
+Mutex GDScriptSamplingProfiler::mutex;
+LocalVector<GDScriptSamplingProfiler::ThreadStack *> GDScriptSamplingProfiler::thread_stacks;
+HashMap<uint32_t, GDScriptSamplingProfiler::Sample> GDScriptSamplingProfiler::samples;
+HashMap<const GDScriptFunction *, uint32_t> GDScriptSamplingProfiler::function_ids;
+LocalVector<String> GDScriptSamplingProfiler::function_labels;
+uint64_t GDScriptSamplingProfiler::sample_count = 0;
+
+Thread *GDScriptSamplingProfiler::sampler_thread = nullptr;
+SafeFlag GDScriptSamplingProfiler::sampler_exit;
+uint64_t GDScriptSamplingProfiler::sample_interval_usec = DEFAULT_SAMPLE_INTERVAL_USEC;
+
+String GDScriptSamplingProfiler::dump_path;
+
+GDScriptSamplingProfiler::ThreadStack *GDScriptSamplingProfiler::_create_thread_stack() {
+	ThreadStack *ts = memnew(ThreadStack);
+	ts->depth.set(0);
+
+	MutexLock lock(mutex);
+	thread_stacks.push_back(ts);
+	thread_stack = ts;
+	thread_stack_generation = stack_generation.get();
+	return ts;
+}
+
+uint32_t GDScriptSamplingProfiler::_get_function_id(const GDScriptFunction *p_function) {
+	const uint32_t *id = function_ids.getptr(p_function);
+	if (id) {
+		return *id;
+	}
+
+	// The function is on a live stack and function_freed() waits for the mutex
+	// held by the caller, so it cannot be freed while its label is built.
+	String source = p_function->get_source();
+	if (source.is_empty()) {
+		source = "<built-in>";
+	}
+	// Spaces and semicolons are separators in the collapsed stack format.
+	function_labels.push_back((source + ":" + String(p_function->get_name())).replace(" ", "_").replace(";", "_"));
+	return function_ids.insert(p_function, function_labels.size() - 1)->value;
+}
+
+void GDScriptSamplingProfiler::_take_sample() {
+	uint32_t frames[MAX_STACK_DEPTH];
+
+	MutexLock lock(mutex);
+	for (ThreadStack *ts : thread_stacks) {
+		uint32_t depth = MIN(ts->depth.get(), MAX_STACK_DEPTH);
+		if (depth == 0) {
+			continue;
+		}
+		for (uint32_t i = 0; i < depth; i++) {
+			frames[i] = _get_function_id(ts->frames[i].get());
+		}
+
+		// Open addressing on the stack hash, collisions are resolved by comparing frames.
+		uint32_t hash = hash_murmur3_buffer(frames, depth * sizeof(uint32_t));
+		while (true) {
+			Sample *sample = samples.getptr(hash);
+			if (!sample) {
+				Sample &new_sample = samples[hash];
+				new_sample.frames.resize(depth);
+				memcpy(new_sample.frames.ptr(), frames, depth * sizeof(uint32_t));
+				new_sample.count = 1;
+				break;
+			}
+			if (sample->frames.size() == depth && memcmp(sample->frames.ptr(), frames, depth * sizeof(uint32_t)) == 0) {
+				sample->count++;
+				break;
+			}
+			hash++;
+		}
+		sample_count++;
+	}
+}
+
+void GDScriptSamplingProfiler::_sampler_thread_func(void *p_userdata) {
+	while (!sampler_exit.is_set()) {
+		OS::get_singleton()->delay_usec(sample_interval_usec);
+		_take_sample();
+	}
+}
+
+void GDScriptSamplingProfiler::function_freed(const GDScriptFunction *p_function) {
+	MutexLock lock(mutex);
+	// The label stays with the recorded samples, but the address may be reused by another function.
+	function_ids.erase(p_function);
+}
+
+uint64_t GDScriptSamplingProfiler::validate_sample_interval(int64_t p_interval_usec) {
+	if (p_interval_usec <= 0) {
+		return DEFAULT_SAMPLE_INTERVAL_USEC;
+	}
+	return CLAMP((uint64_t)p_interval_usec, MIN_SAMPLE_INTERVAL_USEC, MAX_SAMPLE_INTERVAL_USEC);
+}
+
+void GDScriptSamplingProfiler::start(uint64_t p_interval_usec) {
+	if (active.is_set()) {
+		return;
+	}
+	sample_interval_usec = CLAMP(p_interval_usec, MIN_SAMPLE_INTERVAL_USEC, MAX_SAMPLE_INTERVAL_USEC);
+	sampler_exit.clear();
+	tracking_functions.set();
+	active.set();
+
+	sampler_thread = memnew(Thread);
+	sampler_thread->start(_sampler_thread_func, nullptr);
+}
+
+void GDScriptSamplingProfiler::stop() {
+	if (!active.is_set()) {
+		return;
+	}
+	active.clear();
+	sampler_exit.set();
+
+	sampler_thread->wait_to_finish();
+	memdelete(sampler_thread);
+	sampler_thread = nullptr;
+}
+
+void GDScriptSamplingProfiler::clear() {
+	MutexLock lock(mutex);
+	samples.clear();
+	function_ids.clear();
+	function_labels.clear();
+	sample_count = 0;
+	if (!active.is_set()) {
+		tracking_functions.clear();
+	}
+}
+
+uint64_t GDScriptSamplingProfiler::get_sample_count() {
+	MutexLock lock(mutex);
+	return sample_count;
+}
+
+uint64_t GDScriptSamplingProfiler::get_sample_interval() {
+	return sample_interval_usec;
+}
+
+String GDScriptSamplingProfiler::get_collapsed_stacks() {
+	MutexLock lock(mutex);
+
+	String result;
+	for (const KeyValue<uint32_t, Sample> &E : samples) {
+		String line;
+		for (uint32_t i = 0; i < E.value.frames.size(); i++) {
+			if (i > 0) {
+				line += ";";
+			}
+			line += function_labels[E.value.frames[i]];
+		}
+		result += line + " " + itos(E.value.count) + "\n";
+	}
+	return result;
+}
+
+Error GDScriptSamplingProfiler::save_collapsed_stacks(const String &p_path) {
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+	ERR_FAIL_COND_V_MSG(err != OK, err, "Cannot save GDScript sampling profile to file: '" + p_path + "'.");
+	f->store_string(get_collapsed_stacks());
+	return OK;
+}
+
+void GDScriptSamplingProfiler::thread_exit() {
+	if (!_is_thread_stack_valid()) {
+		// Either no stack was created, or it was already freed by finalize().
+		thread_stack = nullptr;
+		return;
+	}
+	MutexLock lock(mutex);
+	thread_stacks.erase(thread_stack);
+	memdelete(thread_stack);
+	thread_stack = nullptr;
+}
+
+void GDScriptSamplingProfiler::_debugger_toggle(void *p_user, bool p_enable, const Array &p_opts) {
+	if (p_enable) {
+		clear();
+		start(validate_sample_interval(p_opts.size() > 0 ? (int64_t)p_opts[0] : 0));
+	} else {
+		stop();
+		if (EngineDebugger::is_active()) {
+			Array msg;
+			msg.push_back(get_collapsed_stacks());
+			msg.push_back(get_sample_count());
+			EngineDebugger::get_singleton()->send_message("gdscript_sampling:stacks", msg);
+		}
+	}
+}
+
+void GDScriptSamplingProfiler::initialize() {
+	EngineDebugger::Profiler profiler(nullptr, _debugger_toggle, nullptr, nullptr);
+	EngineDebugger::register_profiler("gdscript_sampling", profiler);
+
+	uint64_t interval = DEFAULT_SAMPLE_INTERVAL_USEC;
+	List<String> cmdline_args = OS::get_singleton()->get_cmdline_args();
+	for (List<String>::Element *E = cmdline_args.front(); E; E = E->next()) {
+		if (E->get() == "--gdscript-sampling-profile" && E->next()) {
+			dump_path = E->next()->get();
+		} else if (E->get() == "--gdscript-sampling-interval" && E->next()) {
+			const String value = E->next()->get();
+			if (!value.is_valid_int() || value.to_int() <= 0) {
+				WARN_PRINT(vformat("Invalid --gdscript-sampling-interval value \"%s\", using the default of %d microseconds.", value, DEFAULT_SAMPLE_INTERVAL_USEC));
+				continue;
+			}
+			interval = validate_sample_interval(value.to_int());
+			if (interval != (uint64_t)value.to_int()) {
+				WARN_PRINT(vformat("--gdscript-sampling-interval was clamped to %d microseconds (allowed range is %d to %d).", interval, MIN_SAMPLE_INTERVAL_USEC, MAX_SAMPLE_INTERVAL_USEC));
+			}
+		}
+	}
+
+	if (!dump_path.is_empty()) {
+		start(interval);
+	}
+}
+
+void GDScriptSamplingProfiler::finalize() {
+	stop();
+	EngineDebugger::unregister_profiler("gdscript_sampling");
+
+	if (!dump_path.is_empty()) {
+		save_collapsed_stacks(dump_path);
+		dump_path = String();
+	}
+	clear();
+
+	MutexLock lock(mutex);
+	for (ThreadStack *ts : thread_stacks) {
+		memdelete(ts);
+	}
+	thread_stacks.clear();
+	// Other threads still point to the stacks freed above, invalidate them all.
+	stack_generation.increment();
+	thread_stack = nullptr;
+}
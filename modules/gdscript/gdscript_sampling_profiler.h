@@ -0,0 +1,141 @@
+/**************************************************************************/
+/*  gdscript_sampling_profiler.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GDSCRIPT_SAMPLING_PROFILER_H
+#define GDSCRIPT_SAMPLING_PROFILER_H
+
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/string/ustring.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+class GDScriptFunction;
+
+// Statistical profiler that is available in every build type, including
+// template_release. While running, each thread executing GDScript keeps a
+// shadow of its call stack that a dedicated sampler thread reads without
+// locking. Samples are aggregated into collapsed stacks ("a;b;c count"), the
+// input format of common flame graph tools.
+//
+// When stopped, the only cost paid by the VM is a single flag check per call.
+class GDScriptSamplingProfiler {
+public:
+	static constexpr uint32_t MAX_STACK_DEPTH = 256;
+	static constexpr uint64_t DEFAULT_SAMPLE_INTERVAL_USEC = 1000;
+	static constexpr uint64_t MIN_SAMPLE_INTERVAL_USEC = 50;
+	static constexpr uint64_t MAX_SAMPLE_INTERVAL_USEC = 1000000;
+
+	struct ThreadStack {
+		SafeNumeric<uint32_t> depth;
+		SafeNumeric<const GDScriptFunction *> frames[MAX_STACK_DEPTH];
+	};
+
+private:
+	struct Sample {
+		LocalVector<uint32_t> frames;
+		uint64_t count = 0;
+	};
+
+	static SafeFlag active;
+	static SafeFlag tracking_functions;
+	static thread_local ThreadStack *thread_stack;
+	// Thread stacks are freed by finalize() while other threads may still point
+	// to theirs, so a thread only trusts its pointer if the generation matches.
+	static thread_local uint32_t thread_stack_generation;
+	static SafeNumeric<uint32_t> stack_generation;
+
+	static Mutex mutex;
+	static LocalVector<ThreadStack *> thread_stacks;
+	static HashMap<uint32_t, Sample> samples;
+	// Functions are given an ID the first time they are sampled, and forget it
+	// when freed, so a new function allocated at the same address gets its own label.
+	static HashMap<const GDScriptFunction *, uint32_t> function_ids;
+	static LocalVector<String> function_labels;
+	static uint64_t sample_count;
+
+	static Thread *sampler_thread;
+	static SafeFlag sampler_exit;
+	static uint64_t sample_interval_usec;
+
+	static String dump_path;
+
+	static ThreadStack *_create_thread_stack();
+	static void _take_sample();
+	static void _sampler_thread_func(void *p_userdata);
+	static uint32_t _get_function_id(const GDScriptFunction *p_function);
+	_FORCE_INLINE_ static bool _is_thread_stack_valid() { return thread_stack && thread_stack_generation == stack_generation.get(); }
+
+	static void _debugger_toggle(void *p_user, bool p_enable, const Array &p_opts);
+
+public:
+	_FORCE_INLINE_ static bool is_active() { return active.is_set(); }
+
+	_FORCE_INLINE_ static void push(const GDScriptFunction *p_function) {
+		ThreadStack *ts = likely(_is_thread_stack_valid()) ? thread_stack : _create_thread_stack();
+		uint32_t depth = ts->depth.get();
+		if (likely(depth < MAX_STACK_DEPTH)) {
+			ts->frames[depth].set(p_function);
+		}
+		// Publish the frame before the depth, so the sampler never reads an unset slot.
+		ts->depth.set(depth + 1);
+	}
+
+	_FORCE_INLINE_ static void pop() {
+		if (unlikely(!_is_thread_stack_valid())) {
+			return;
+		}
+		ThreadStack *ts = thread_stack;
+		if (likely(ts->depth.get() > 0)) {
+			ts->depth.set(ts->depth.get() - 1);
+		}
+	}
+
+	static void function_freed(const GDScriptFunction *p_function);
+	_FORCE_INLINE_ static bool is_tracking_functions() { return tracking_functions.is_set(); }
+
+	static uint64_t validate_sample_interval(int64_t p_interval_usec);
+	static void start(uint64_t p_interval_usec = DEFAULT_SAMPLE_INTERVAL_USEC);
+	static void stop();
+	static void clear();
+	static uint64_t get_sample_count();
+	static uint64_t get_sample_interval();
+
+	static String get_collapsed_stacks();
+	static Error save_collapsed_stacks(const String &p_path);
+
+	static void thread_exit();
+
+	static void initialize();
+	static void finalize();
+};
+
+#endif // GDSCRIPT_SAMPLING_PROFILER_H
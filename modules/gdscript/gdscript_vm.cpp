@@ -31,6 +31,7 @@
 #include "gdscript.h"
 #include "gdscript_function.h"
 #include "gdscript_lambda_callable.h"
+#include "gdscript_sampling_profiler.h"
 
 #include "core/core_string_names.h"
 #include "core/os/os.h"
@@ -494,6 +495,19 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 		}
 
+#ifdef GDSCRIPT_TIER_UP_ENABLED
+		// Coroutines always resume in the interpreter, so only new calls are counted.
+		TierEntry entry = tier_entry.load(std::memory_order_acquire);
+		if (entry == nullptr && unlikely(tier_call_count.increment() == tier_up_threshold)) {
+			_tier_up();
+			entry = tier_entry.load(std::memory_order_acquire);
+		}
+		if (entry != nullptr && entry(this, p_instance, p_args, p_argcount, retvalue, r_err)) {
+			call_depth--;
+			return retvalue;
+		}
+#endif // GDSCRIPT_TIER_UP_ENABLED
+
 		// Add 3 here for self, class, and nil.
 		alloca_size = sizeof(Variant *) * 3 + sizeof(Variant *) * _instruction_args_size + sizeof(Variant) * _stack_size;
 
@@ -536,8 +550,9 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			instruction_args = nullptr;
 		}
 
-		for (const KeyValue<int, Variant::Type> &E : temporary_slots) {
-			type_init_function_table[E.value](&stack[E.key]);
+		for (int i = 0; i < _temporary_slots_count; i++) {
+			const Pair<int, Variant::Type> &slot = _temporary_slots_ptr[i];
+			type_init_function_table[slot.second](&stack[slot.first]);
 		}
 	}
 
@@ -551,6 +566,11 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 	memnew_placement(&stack[ADDR_STACK_CLASS], Variant(script));
 	memnew_placement(&stack[ADDR_STACK_NIL], Variant);
 
+	const bool sampling = GDScriptSamplingProfiler::is_active();
+	if (unlikely(sampling)) {
+		GDScriptSamplingProfiler::push(this);
+	}
+
 	String err_text;
 
 #ifdef DEBUG_ENABLED
@@ -2256,11 +2276,21 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					Ref<GDScriptFunctionState> gdfs = memnew(GDScriptFunctionState);
 					gdfs->function = this;
 
-					gdfs->state.stack.resize(alloca_size);
+					gdfs->state.stack = GDScriptFunctionState::_acquire_stack(alloca_size);
 
 					// First 3 stack addresses are special, so we just skip them here.
-					for (int i = 3; i < _stack_size; i++) {
-						memnew_placement(&gdfs->state.stack.write[sizeof(Variant) * i], Variant(stack[i]));
+					Variant *state_stack = (Variant *)gdfs->state.stack.ptrw();
+					if (likely(GDScriptFunctionState::stack_pooling)) {
+						// This function returns right after suspending, so values are relocated instead of copied,
+						// which avoids a reference count round trip for every non-trivial stack slot.
+						memcpy((void *)&state_stack[3], (const void *)&stack[3], sizeof(Variant) * (_stack_size - 3));
+						for (int i = 3; i < _stack_size; i++) {
+							memnew_placement(&stack[i], Variant);
+						}
+					} else {
+						for (int i = 3; i < _stack_size; i++) {
+							memnew_placement(&state_stack[i], Variant(stack[i]));
+						}
 					}
 					gdfs->state.stack_size = _stack_size;
 					gdfs->state.alloca_size = alloca_size;
@@ -3560,6 +3590,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 		stack[i].~Variant();
 	}
 
+	if (unlikely(sampling)) {
+		GDScriptSamplingProfiler::pop();
+	}
+
 	call_depth--;
 
 	return retvalue;
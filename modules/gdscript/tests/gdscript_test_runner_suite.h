@@ -33,10 +33,23 @@
 
 #include "gdscript_test_runner.h"
 
+#include "scene/main/window.h"
+
 #include "tests/test_macros.h"
 
 namespace GDScriptTests {
 
+#ifdef GDSCRIPT_TIER_UP_ENABLED
+// Stand-in for a second tier, which gives every function back to the interpreter.
+static bool deoptimizing_tier_entry(GDScriptFunction *p_function, GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err) {
+	return false;
+}
+
+static GDScriptFunction::TierEntry deoptimizing_tier_compiler(const GDScriptFunction *p_function) {
+	return deoptimizing_tier_entry;
+}
+#endif // GDSCRIPT_TIER_UP_ENABLED
+
 TEST_SUITE("[Modules][GDScript]") {
 	// GDScript 2.0 is still under heavy construction.
 	// Allow the tests to fail, but do not ignore errors during development.
@@ -48,6 +61,29 @@ TEST_SUITE("[Modules][GDScript]") {
 		INFO("Make sure `*.out` files have expected results.");
 		REQUIRE_MESSAGE(fail_count == 0, "All GDScript tests should pass.");
 	}
+
+#ifdef GDSCRIPT_TIER_UP_ENABLED
+	TEST_CASE("Script compilation and runtime in the second tier") {
+		// Every function tiers up on its first call, so the scripts must give the same output in both tiers.
+		// Without a registered tier, this checks that deoptimizing is transparent.
+		const GDScriptFunction::TierCompiler compiler = GDScriptFunction::get_tier_compiler();
+		const uint32_t threshold = GDScriptFunction::get_tier_up_threshold();
+		if (compiler == nullptr) {
+			GDScriptFunction::set_tier_compiler(deoptimizing_tier_compiler);
+		}
+		GDScriptFunction::set_tier_up_threshold(1);
+
+		bool print_filenames = OS::get_singleton()->get_cmdline_args().find("--print-filenames") != nullptr;
+		GDScriptTestRunner runner("modules/gdscript/tests/scripts", true, print_filenames);
+		int fail_count = runner.run_tests();
+
+		GDScriptFunction::set_tier_compiler(compiler);
+		GDScriptFunction::set_tier_up_threshold(threshold);
+
+		INFO("Make sure `*.out` files have expected results.");
+		REQUIRE_MESSAGE(fail_count == 0, "All GDScript tests should pass after tiering up.");
+	}
+#endif // GDSCRIPT_TIER_UP_ENABLED
 }
 
 TEST_CASE("[Modules][GDScript] Load source code dynamically and run it") {
@@ -71,6 +107,212 @@ func _init():
 	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The script should assign object metadata successfully.");
 }
 
+#ifdef GDSCRIPT_TIER_UP_ENABLED
+static int tier_compile_count = 0;
+
+static bool constant_tier_entry(GDScriptFunction *p_function, GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err) {
+	if (p_argcount != 1 || p_args[0]->get_type() != Variant::INT) {
+		return false;
+	}
+	r_ret = -1;
+	return true;
+}
+
+static GDScriptFunction::TierEntry constant_tier_compiler(const GDScriptFunction *p_function) {
+	tier_compile_count++;
+	return p_function->get_name() == StringName("double") ? constant_tier_entry : nullptr;
+}
+
+TEST_CASE("[Modules][GDScript] Hot functions tier up") {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(R"(
+extends RefCounted
+
+func double(value):
+	return value * 2
+
+func triple(value):
+	return value * 3
+)");
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(error == OK, "The script should parse successfully.");
+
+	const GDScriptFunction::TierCompiler compiler = GDScriptFunction::get_tier_compiler();
+	const uint32_t threshold = GDScriptFunction::get_tier_up_threshold();
+	GDScriptFunction::set_tier_compiler(constant_tier_compiler);
+	GDScriptFunction::set_tier_up_threshold(3);
+	tier_compile_count = 0;
+
+	Ref<RefCounted> ref_counted = memnew(RefCounted);
+	ref_counted->set_script(gdscript);
+
+	CHECK(int(ref_counted->call("double", 1)) == 2);
+	CHECK(int(ref_counted->call("double", 2)) == 4);
+	CHECK_MESSAGE(tier_compile_count == 0, "Functions should run in the interpreter until they are hot.");
+	CHECK_MESSAGE(int(ref_counted->call("double", 3)) == -1, "The call reaching the threshold should run in the second tier.");
+	CHECK(int(ref_counted->call("double", 4)) == -1);
+	CHECK_MESSAGE(float(ref_counted->call("double", 1.5)) == doctest::Approx(3.0), "Deoptimized calls should run in the interpreter.");
+	CHECK(tier_compile_count == 1);
+
+	for (int i = 0; i < 5; i++) {
+		CHECK_MESSAGE(int(ref_counted->call("triple", i)) == i * 3, "Functions the tier can't compile should stay in the interpreter.");
+	}
+	CHECK(tier_compile_count == 2);
+
+	GDScriptFunction::set_tier_compiler(compiler);
+	GDScriptFunction::set_tier_up_threshold(threshold);
+}
+#endif // GDSCRIPT_TIER_UP_ENABLED
+
+TEST_CASE("[Modules][GDScript][Benchmark] Coroutine suspend and resume" * doctest::skip()) {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(R"(
+extends RefCounted
+
+signal tick
+
+var resumed := 0
+
+func wait_ticks(p_count: int) -> void:
+	var factor := 1.5
+	var label := "locals"
+	var values := [factor, label]
+	for i in p_count:
+		await tick
+		resumed += values.size()
+)");
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(error == OK, "The script should parse successfully.");
+
+	// Every resume suspends again, so each iteration acquires and releases a coroutine stack.
+	const int iterations = 1000000;
+	const bool pooling = GDScriptFunctionState::is_stack_pooling_enabled();
+	uint64_t elapsed[2] = {};
+	for (int pooled = 0; pooled < 2; pooled++) {
+		// Without pooling, every await allocates a stack and copies the values into it.
+		GDScriptFunctionState::set_stack_pooling_enabled(pooled);
+
+		Ref<RefCounted> ref_counted = memnew(RefCounted);
+		ref_counted->set_script(gdscript);
+		ref_counted->call("wait_ticks", iterations);
+
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < iterations; i++) {
+			ref_counted->emit_signal("tick");
+		}
+		elapsed[pooled] = OS::get_singleton()->get_ticks_usec() - begin;
+
+		CHECK(int(ref_counted->get("resumed")) == iterations * 2);
+	}
+	GDScriptFunctionState::set_stack_pooling_enabled(pooling);
+
+	MESSAGE("Resume and suspend on await, allocated and copied stacks: ", elapsed[0] * 1000.0 / iterations, " ns per iteration.");
+	MESSAGE("Resume and suspend on await, pooled and relocated stacks: ", elapsed[1] * 1000.0 / iterations, " ns per iteration (", double(elapsed[0]) / MAX(elapsed[1], uint64_t(1)), "x faster).");
+}
+
+TEST_CASE("[SceneTree][Modules][GDScript] Process callbacks of scripted nodes") {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(R"(
+extends Node
+
+class Base extends Node:
+	var processed := 0.0
+	var physics_processed := 0.0
+	var order := []
+
+	func _process(delta):
+		processed += delta
+
+	func _physics_process(delta):
+		physics_processed += delta
+
+	func _notification(what):
+		if what == NOTIFICATION_PROCESS:
+			order.push_back("base")
+
+class Derived extends Base:
+	func _notification(what):
+		if what == NOTIFICATION_PROCESS:
+			order.push_back("derived")
+)");
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(error == OK, "The script should parse successfully.");
+
+	Ref<GDScript> derived = gdscript->get("Derived");
+	REQUIRE(derived.is_valid());
+
+	Node *node = memnew(Node);
+	node->set_script(derived);
+	SceneTree::get_singleton()->get_root()->add_child(node);
+	CHECK(node->is_processing());
+	CHECK(node->is_physics_processing());
+
+	SceneTree::get_singleton()->process(0.5);
+	SceneTree::get_singleton()->process(0.25);
+	SceneTree::get_singleton()->physics_process(0.125);
+
+	// The callbacks are inherited from the base class.
+	CHECK(double(node->get("processed")) == doctest::Approx(0.75));
+	CHECK(double(node->get("physics_processed")) == doctest::Approx(0.125));
+
+	// Notifications run at all levels of the script, base first.
+	Array order = node->get("order");
+	REQUIRE(order.size() == 4);
+	CHECK(order[0] == Variant("base"));
+	CHECK(order[1] == Variant("derived"));
+	CHECK(order[2] == Variant("base"));
+	CHECK(order[3] == Variant("derived"));
+
+	memdelete(node);
+}
+
+// Run with `--no-skip` to print the average cost of processing a scripted node.
+TEST_CASE("[SceneTree][Modules][GDScript][Benchmark] Per-node process overhead" * doctest::skip()) {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(R"(
+extends Node
+
+func _process(delta):
+	pass
+)");
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(error == OK, "The script should parse successfully.");
+
+	const int node_count = 20000;
+	const int frame_count = 100;
+
+	LocalVector<Node *> nodes;
+	for (int i = 0; i < node_count; i++) {
+		Node *node = memnew(Node);
+		node->set_script(gdscript);
+		SceneTree::get_singleton()->get_root()->add_child(node);
+		nodes.push_back(node);
+	}
+	REQUIRE(nodes[0]->is_processing());
+
+	SceneTree::get_singleton()->process(0); // Warm up, sorts the process list.
+
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < frame_count; i++) {
+		SceneTree::get_singleton()->process(0);
+	}
+	const uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("%d scripted nodes, %d frames: %.1f ns per node.", node_count, frame_count, double(elapsed) * 1000.0 / (double(node_count) * frame_count)));
+
+	for (Node *node : nodes) {
+		memdelete(node);
+	}
+}
+
 TEST_CASE("[Modules][GDScript] Validate built-in API") {
 	GDScriptLanguage *lang = GDScriptLanguage::get_singleton();
 
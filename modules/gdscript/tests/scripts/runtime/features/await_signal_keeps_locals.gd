@@ -0,0 +1,15 @@
+signal resumed
+
+func coroutine(label: String) -> void:
+	var values := [label, { "key": label }, "str_" + label]
+	for i in 3:
+		await resumed
+		values.append(i)
+	print(values.size(), " ", values[0], " ", values[1].key, " ", values[2], " ", values[5])
+
+func test():
+	coroutine("a")
+	coroutine("b")
+	for i in 3:
+		resumed.emit()
+	print("end")
@@ -0,0 +1,32 @@
+# Typed temporaries are initialized in the call prologue, so every call starts from clean slots.
+
+func sum_vectors(count: int) -> Vector2:
+	var total := Vector2()
+	for i in count:
+		total += Vector2(i, i * 2) * 0.5
+	return total
+
+
+func concat(parts: Array[String]) -> String:
+	var result := ""
+	for part in parts:
+		result += part + "-"
+	return result
+
+
+func recurse(depth: int) -> int:
+	if depth == 0:
+		return 0
+	var a := depth * 2
+	var b := float(a) / 2.0
+	return a + int(b) + recurse(depth - 1)
+
+
+func test():
+	print(sum_vectors(4))
+	print(sum_vectors(4))
+	print(concat(["a", "b", "c"]))
+	print(concat(["a", "b", "c"]))
+	print(recurse(5))
+	for i in 3:
+		print(recurse(i))
@@ -0,0 +1,162 @@
+/**************************************************************************/
+/*  test_gdscript_sampling_profiler.h                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_GDSCRIPT_SAMPLING_PROFILER_H
+#define TEST_GDSCRIPT_SAMPLING_PROFILER_H
+
+#include "../gdscript.h"
+#include "../gdscript_sampling_profiler.h"
+
+#include "core/os/os.h"
+#include "core/os/thread.h"
+
+#include "tests/test_macros.h"
+
+namespace GDScriptTests {
+
+static Ref<RefCounted> create_sampled_object(const String &p_function_name) {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(vformat(R"(
+extends RefCounted
+
+func %s(p_usec: int) -> int:
+	var start := Time.get_ticks_usec()
+	var iterations := 0
+	while Time.get_ticks_usec() - start < p_usec:
+		iterations += 1
+	return iterations
+)",
+			p_function_name));
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE_MESSAGE(error == OK, "The script should parse successfully.");
+
+	Ref<RefCounted> object = memnew(RefCounted);
+	object->set_script(gdscript);
+	return object;
+}
+
+// Calls the function until the sampler records it, or gives up after about a second.
+static void run_until_sampled(const Ref<RefCounted> &p_object, const StringName &p_function_name) {
+	const uint64_t initial_count = GDScriptSamplingProfiler::get_sample_count();
+	for (int i = 0; i < 100 && GDScriptSamplingProfiler::get_sample_count() == initial_count; i++) {
+		p_object->call(p_function_name, 10000);
+	}
+}
+
+TEST_CASE("[Modules][GDScript][SamplingProfiler] Sample interval validation") {
+	CHECK(GDScriptSamplingProfiler::validate_sample_interval(0) == GDScriptSamplingProfiler::DEFAULT_SAMPLE_INTERVAL_USEC);
+	CHECK(GDScriptSamplingProfiler::validate_sample_interval(-100) == GDScriptSamplingProfiler::DEFAULT_SAMPLE_INTERVAL_USEC);
+	CHECK(GDScriptSamplingProfiler::validate_sample_interval(1) == GDScriptSamplingProfiler::MIN_SAMPLE_INTERVAL_USEC);
+	CHECK(GDScriptSamplingProfiler::validate_sample_interval(2000) == 2000);
+	CHECK(GDScriptSamplingProfiler::validate_sample_interval(INT64_MAX) == GDScriptSamplingProfiler::MAX_SAMPLE_INTERVAL_USEC);
+
+	GDScriptSamplingProfiler::start(1);
+	CHECK(GDScriptSamplingProfiler::get_sample_interval() == GDScriptSamplingProfiler::MIN_SAMPLE_INTERVAL_USEC);
+	GDScriptSamplingProfiler::stop();
+	GDScriptSamplingProfiler::clear();
+}
+
+TEST_CASE("[Modules][GDScript][SamplingProfiler] Collapsed stacks") {
+	GDScriptSamplingProfiler::clear();
+	GDScriptSamplingProfiler::start(GDScriptSamplingProfiler::MIN_SAMPLE_INTERVAL_USEC);
+
+	SUBCASE("Running functions are sampled") {
+		Ref<RefCounted> object = create_sampled_object("sampled_function");
+		run_until_sampled(object, "sampled_function");
+
+		CHECK(GDScriptSamplingProfiler::get_sample_count() > 0);
+		CHECK(GDScriptSamplingProfiler::get_collapsed_stacks().contains("sampled_function"));
+	}
+
+	SUBCASE("Freed functions keep their own label") {
+		Ref<RefCounted> first = create_sampled_object("first_function");
+		run_until_sampled(first, "first_function");
+		first.unref();
+
+		// The new function may be allocated where the freed one was.
+		Ref<RefCounted> second = create_sampled_object("second_function");
+		run_until_sampled(second, "second_function");
+		GDScriptSamplingProfiler::stop();
+
+		const String stacks = GDScriptSamplingProfiler::get_collapsed_stacks();
+		CHECK(stacks.contains("first_function"));
+		CHECK(stacks.contains("second_function"));
+	}
+
+	GDScriptSamplingProfiler::stop();
+	GDScriptSamplingProfiler::clear();
+}
+
+struct SamplingThreadData {
+	Ref<RefCounted> object;
+	SafeNumeric<int> phase;
+};
+
+static void sampling_thread_func(void *p_userdata) {
+	SamplingThreadData *data = static_cast<SamplingThreadData *>(p_userdata);
+	data->object->call("threaded_function", 1000);
+	data->phase.set(1);
+	while (data->phase.get() != 2) {
+		OS::get_singleton()->delay_usec(100);
+	}
+	// The stack created before finalize() was freed, a new one must be created.
+	run_until_sampled(data->object, "threaded_function");
+}
+
+TEST_CASE("[Modules][GDScript][SamplingProfiler] Finalize while other threads hold a stack") {
+	SamplingThreadData data;
+	data.object = create_sampled_object("threaded_function");
+
+	GDScriptSamplingProfiler::clear();
+	GDScriptSamplingProfiler::start(GDScriptSamplingProfiler::MIN_SAMPLE_INTERVAL_USEC);
+
+	Thread thread;
+	thread.start(sampling_thread_func, &data);
+	while (data.phase.get() != 1) {
+		OS::get_singleton()->delay_usec(100);
+	}
+
+	GDScriptSamplingProfiler::finalize();
+	GDScriptSamplingProfiler::initialize();
+	GDScriptSamplingProfiler::start(GDScriptSamplingProfiler::MIN_SAMPLE_INTERVAL_USEC);
+
+	data.phase.set(2);
+	thread.wait_to_finish();
+
+	GDScriptSamplingProfiler::stop();
+	CHECK(GDScriptSamplingProfiler::get_sample_count() > 0);
+	GDScriptSamplingProfiler::clear();
+}
+
+} // namespace GDScriptTests
+
+#endif // TEST_GDSCRIPT_SAMPLING_PROFILER_H
@@ -0,0 +1,16 @@
+def can_build(env, platform):
+    return env.editor_build
+
+
+def configure(env):
+    pass
+
+
+def get_doc_classes():
+    return [
+        "LightmapperCPU",
+    ]
+
+
+def get_doc_path():
+    return "doc_classes"
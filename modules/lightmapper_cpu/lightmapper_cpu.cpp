@@ -0,0 +1,1054 @@
+/**************************************************************************/
+/*  lightmapper_cpu.cpp                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "lightmapper_cpu.h"
+
+#include "core/config/project_settings.h"
+#include "core/math/geometry_2d.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+
+// Same hash as the GPU lightmapper, so both backends draw from comparable sequences.
+// https://www.reedbeta.com/blog/hash-functions-for-gpu-rendering/
+static _FORCE_INLINE_ uint32_t _hash(uint32_t p_value) {
+	uint32_t state = p_value * 747796405u + 2891336453u;
+	uint32_t word = ((state >> ((state >> 28u) + 4u)) ^ state) * 277803737u;
+	return (word >> 22u) ^ word;
+}
+
+// Returns a random value in the [0.0, 1.0) range.
+static _FORCE_INLINE_ float _randomize(uint32_t &r_value) {
+	r_value = _hash(r_value);
+	return float(r_value / 4294967296.0);
+}
+
+static _FORCE_INLINE_ Vector3 _generate_ray_dir_from_normal(const Vector3 &p_normal, uint32_t &r_noise) {
+	float noise1 = _randomize(r_noise);
+	float noise2 = _randomize(r_noise) * 2.0 * Math_PI;
+	Vector3 local = Vector3(Math::sqrt(noise1) * Math::cos(noise2), Math::sqrt(noise1) * Math::sin(noise2), Math::sqrt(1.0f - noise1));
+
+	Vector3 v0 = Math::abs(p_normal.z) < 0.999 ? Vector3(0.0, 0.0, 1.0) : Vector3(0.0, 1.0, 0.0);
+	Vector3 tangent = v0.cross(p_normal).normalized();
+	Vector3 bitangent = tangent.cross(p_normal).normalized();
+	return tangent * local.x + bitangent * local.y + p_normal * local.z;
+}
+
+static _FORCE_INLINE_ Vector3 _generate_sphere_uniform_direction(uint32_t &r_noise) {
+	float theta = 2.0 * Math_PI * _randomize(r_noise);
+	float phi = Math::acos(1.0f - 2.0f * _randomize(r_noise));
+	return Vector3(Math::sin(phi) * Math::cos(theta), Math::sin(phi) * Math::sin(theta), Math::cos(phi));
+}
+
+static _FORCE_INLINE_ float _get_omni_attenuation(float p_distance, float p_inv_range, float p_decay) {
+	float nd = p_distance * p_inv_range;
+	nd *= nd;
+	nd *= nd; // nd^4
+	nd = MAX(1.0f - nd, 0.0f);
+	nd *= nd; // nd^2
+	return nd * Math::pow(MAX(p_distance, 0.0001f), -p_decay);
+}
+
+static _FORCE_INLINE_ void _sh_l1_coefficients(const Vector3 &p_dir, float r_c[4]) {
+	r_c[0] = 0.282095; // l0
+	r_c[1] = 0.488603 * p_dir.y; // l1n1
+	r_c[2] = 0.488603 * p_dir.z; // l1n0
+	r_c[3] = 0.488603 * p_dir.x; // l1p1
+}
+
+void LightmapperCPU::add_mesh(const MeshData &p_mesh) {
+	ERR_FAIL_COND(p_mesh.albedo_on_uv2.is_null() || p_mesh.albedo_on_uv2->is_empty());
+	ERR_FAIL_COND(p_mesh.emission_on_uv2.is_null() || p_mesh.emission_on_uv2->is_empty());
+	ERR_FAIL_COND(p_mesh.albedo_on_uv2->get_width() != p_mesh.emission_on_uv2->get_width());
+	ERR_FAIL_COND(p_mesh.albedo_on_uv2->get_height() != p_mesh.emission_on_uv2->get_height());
+	ERR_FAIL_COND(p_mesh.points.size() == 0);
+	MeshInstance mi;
+	mi.data = p_mesh;
+	mesh_instances.push_back(mi);
+}
+
+void LightmapperCPU::add_directional_light(bool p_static, const Vector3 &p_direction, const Color &p_color, float p_energy, float p_indirect_energy, float p_angular_distance, float p_shadow_blur) {
+	Light l;
+	l.type = LIGHT_TYPE_DIRECTIONAL;
+	l.direction = p_direction;
+	l.color = p_color;
+	l.energy = p_energy;
+	l.indirect_energy = p_indirect_energy;
+	l.static_bake = p_static;
+	l.size = Math::tan(Math::deg_to_rad(p_angular_distance));
+	l.shadow_blur = p_shadow_blur;
+	lights.push_back(l);
+}
+
+void LightmapperCPU::add_omni_light(bool p_static, const Vector3 &p_position, const Color &p_color, float p_energy, float p_indirect_energy, float p_range, float p_attenuation, float p_size, float p_shadow_blur) {
+	Light l;
+	l.type = LIGHT_TYPE_OMNI;
+	l.position = p_position;
+	l.range = p_range;
+	l.attenuation = p_attenuation;
+	l.color = p_color;
+	l.energy = p_energy;
+	l.indirect_energy = p_indirect_energy;
+	l.static_bake = p_static;
+	l.size = p_size;
+	l.shadow_blur = p_shadow_blur;
+	lights.push_back(l);
+}
+
+void LightmapperCPU::add_spot_light(bool p_static, const Vector3 &p_position, const Vector3 p_direction, const Color &p_color, float p_energy, float p_indirect_energy, float p_range, float p_attenuation, float p_spot_angle, float p_spot_attenuation, float p_size, float p_shadow_blur) {
+	Light l;
+	l.type = LIGHT_TYPE_SPOT;
+	l.position = p_position;
+	l.direction = p_direction;
+	l.range = p_range;
+	l.attenuation = p_attenuation;
+	l.cos_spot_angle = Math::cos(Math::deg_to_rad(p_spot_angle));
+	l.inv_spot_attenuation = 1.0f / p_spot_attenuation;
+	l.color = p_color;
+	l.energy = p_energy;
+	l.indirect_energy = p_indirect_energy;
+	l.static_bake = p_static;
+	l.size = p_size;
+	l.shadow_blur = p_shadow_blur;
+	lights.push_back(l);
+}
+
+void LightmapperCPU::add_probe(const Vector3 &p_position) {
+	probe_positions.push_back(p_position);
+}
+
+Lightmapper::BakeError LightmapperCPU::_blit_meshes_into_atlas(int p_max_texture_size, Size2i &r_atlas_size, int &r_atlas_slices, BakeStepFunc p_step_function, void *p_bake_userdata) {
+	Vector<Size2i> sizes;
+
+	for (int m_i = 0; m_i < mesh_instances.size(); m_i++) {
+		const MeshInstance &mi = mesh_instances[m_i];
+		Size2i s = Size2i(mi.data.albedo_on_uv2->get_width(), mi.data.albedo_on_uv2->get_height());
+		sizes.push_back(s);
+		r_atlas_size.width = MAX(r_atlas_size.width, s.width + 2);
+		r_atlas_size.height = MAX(r_atlas_size.height, s.height + 2);
+	}
+
+	int max = nearest_power_of_2_templated(r_atlas_size.width);
+	max = MAX(max, nearest_power_of_2_templated(r_atlas_size.height));
+
+	if (max > p_max_texture_size) {
+		return BAKE_ERROR_LIGHTMAP_TOO_SMALL;
+	}
+
+	if (p_step_function) {
+		p_step_function(0.1, RTR("Determining optimal atlas size"), p_bake_userdata, true);
+	}
+
+	Size2i atlas_size = Size2i(max, max);
+
+	Size2i best_atlas_size;
+	int best_atlas_slices = 0;
+	int best_atlas_memory = 0x7FFFFFFF;
+	Vector<Vector3i> best_atlas_offsets;
+
+	// Determine the best texture array atlas size by bruteforce fitting, like LightmapperRD does.
+	while (atlas_size.x <= p_max_texture_size && atlas_size.y <= p_max_texture_size) {
+		Vector<Vector2i> source_sizes;
+		Vector<int> source_indices;
+		source_sizes.resize(sizes.size());
+		source_indices.resize(sizes.size());
+		for (int i = 0; i < source_indices.size(); i++) {
+			source_sizes.write[i] = sizes[i] + Vector2i(2, 2); // Add padding between lightmaps.
+			source_indices.write[i] = i;
+		}
+		Vector<Vector3i> atlas_offsets;
+		atlas_offsets.resize(source_sizes.size());
+
+		int slices = 0;
+
+		while (source_sizes.size() > 0) {
+			Vector<Vector3i> offsets = Geometry2D::partial_pack_rects(source_sizes, atlas_size);
+			Vector<int> new_indices;
+			Vector<Vector2i> new_sources;
+			for (int i = 0; i < offsets.size(); i++) {
+				Vector3i ofs = offsets[i];
+				int sidx = source_indices[i];
+				if (ofs.z > 0) {
+					ofs.z = slices;
+					atlas_offsets.write[sidx] = ofs + Vector3i(1, 1, 0); // Center lightmap in the reserved oversized region.
+				} else {
+					new_indices.push_back(sidx);
+					new_sources.push_back(source_sizes[i]);
+				}
+			}
+
+			source_sizes = new_sources;
+			source_indices = new_indices;
+			slices++;
+		}
+
+		int mem_used = atlas_size.x * atlas_size.y * slices;
+		if (mem_used < best_atlas_memory) {
+			best_atlas_size = atlas_size;
+			best_atlas_offsets = atlas_offsets;
+			best_atlas_slices = slices;
+			best_atlas_memory = mem_used;
+		}
+
+		if (atlas_size.width == atlas_size.height) {
+			atlas_size.width *= 2;
+		} else {
+			atlas_size.height *= 2;
+		}
+	}
+
+	r_atlas_size = best_atlas_size;
+	r_atlas_slices = best_atlas_slices;
+
+	for (int m_i = 0; m_i < mesh_instances.size(); m_i++) {
+		MeshInstance &mi = mesh_instances.write[m_i];
+		mi.offset.x = best_atlas_offsets[m_i].x;
+		mi.offset.y = best_atlas_offsets[m_i].y;
+		mi.slice = best_atlas_offsets[m_i].z;
+	}
+
+	return BAKE_OK;
+}
+
+void LightmapperCPU::_plot_mesh(uint32_t p_index, uint32_t p_offset) {
+	// Meshes own disjoint atlas regions (including their padding), so they can be plotted in parallel.
+	p_index += p_offset;
+	const MeshInstance &mi = mesh_instances[p_index];
+	const Size2i size = mi.data.albedo_on_uv2->get_size();
+	const Rect2i region = Rect2i(mi.offset - Vector2i(1, 1), size + Vector2i(2, 2)).intersection(Rect2i(Vector2i(), state->atlas_size));
+
+	// Texels whose center is inside a triangle take precedence over texels that are only grazed by one.
+	LocalVector<uint8_t> covered;
+	covered.resize(region.size.width * region.size.height);
+	memset(covered.ptr(), 0, covered.size());
+
+	const Vector3 *points = mi.data.points.ptr();
+	const Vector3 *normals = mi.data.normal.ptr();
+	const Vector2 *uvs = mi.data.uv2.ptr();
+
+	for (int i = 0; i + 2 < mi.data.points.size(); i += 3) {
+		Vector2 v[3];
+		for (int k = 0; k < 3; k++) {
+			v[k] = uvs[i + k] * Vector2(size) + Vector2(mi.offset);
+		}
+
+		float area = (v[1] - v[0]).cross(v[2] - v[0]);
+		if (Math::abs(area) < CMP_EPSILON) {
+			continue; // Degenerate in UV space, nothing to plot.
+		}
+		float inv_area = 1.0 / area;
+
+		// Distance (in texels) from each vertex to the opposite edge, to turn barycentrics into edge distances.
+		float heights[3];
+		for (int k = 0; k < 3; k++) {
+			float edge_length = (v[(k + 2) % 3] - v[(k + 1) % 3]).length();
+			heights[k] = edge_length > CMP_EPSILON ? Math::abs(area) / edge_length : 0.0;
+		}
+
+		Rect2 bounds = Rect2(v[0], Vector2());
+		bounds.expand_to(v[1]);
+		bounds.expand_to(v[2]);
+		Rect2i texels = Rect2i(Math::floor(bounds.position.x) - 1, Math::floor(bounds.position.y) - 1, Math::ceil(bounds.size.x) + 3, Math::ceil(bounds.size.y) + 3).intersection(region);
+
+		for (int y = texels.position.y; y < texels.get_end().y; y++) {
+			for (int x = texels.position.x; x < texels.get_end().x; x++) {
+				Vector2 p = Vector2(x + 0.5, y + 0.5);
+				float b[3];
+				b[0] = (v[1] - p).cross(v[2] - p) * inv_area;
+				b[1] = (v[2] - p).cross(v[0] - p) * inv_area;
+				b[2] = 1.0 - b[0] - b[1];
+
+				uint8_t coverage = 2;
+				if (b[0] < 0.0 || b[1] < 0.0 || b[2] < 0.0) {
+					// Conservative rasterization: also plot texels whose center is less than a texel away from the triangle.
+					if (b[0] * heights[0] < -0.75 || b[1] * heights[1] < -0.75 || b[2] * heights[2] < -0.75) {
+						continue;
+					}
+					coverage = 1;
+					b[0] = MAX(b[0], 0.0f);
+					b[1] = MAX(b[1], 0.0f);
+					b[2] = MAX(b[2], 0.0f);
+					float sum = b[0] + b[1] + b[2];
+					b[0] /= sum;
+					b[1] /= sum;
+					b[2] /= sum;
+				}
+
+				uint8_t &texel_coverage = covered[(y - region.position.y) * region.size.width + (x - region.position.x)];
+				if (texel_coverage >= coverage) {
+					continue;
+				}
+				texel_coverage = coverage;
+
+				uint32_t index = _texel_index(mi.slice, x, y);
+				state->positions[index] = points[i] * b[0] + points[i + 1] * b[1] + points[i + 2] * b[2];
+				state->normals[index] = (normals[i] * b[0] + normals[i + 1] * b[1] + normals[i + 2] * b[2]).normalized();
+
+				Vector2i src = Vector2i(CLAMP(x - mi.offset.x, 0, size.width - 1), CLAMP(y - mi.offset.y, 0, size.height - 1));
+				state->albedo[index] = mi.data.albedo_on_uv2->get_pixelv(src);
+				state->emission[index] = mi.data.emission_on_uv2->get_pixelv(src);
+			}
+		}
+	}
+}
+
+uint32_t LightmapperCPU::_hit_texel(const LightmapRaycaster::Ray &p_ray) const {
+	// The raycaster replaces the hit barycentrics with the interpolated UV2 of the mesh.
+	const MeshInstance &mi = mesh_instances[p_ray.geomID];
+	const Size2i size = mi.data.albedo_on_uv2->get_size();
+	int x = CLAMP(int(p_ray.u * size.width), 0, size.width - 1) + mi.offset.x;
+	int y = CLAMP(int(p_ray.v * size.height), 0, size.height - 1) + mi.offset.y;
+	return _texel_index(mi.slice, x, y);
+}
+
+Color LightmapperCPU::_sample_environment(const Vector3 &p_dir) const {
+	if (state->environment.is_null()) {
+		return Color(0, 0, 0);
+	}
+
+	Vector3 sky_dir = state->environment_transform.xform(p_dir).normalized();
+	Vector2 st = Vector2(Math::atan2(sky_dir.x, sky_dir.z), Math::acos(CLAMP(sky_dir.y, -1.0f, 1.0f)));
+	if (st.x < 0.0) {
+		st.x += Math_TAU;
+	}
+
+	Size2i size = state->environment->get_size();
+	int x = CLAMP(int(st.x / Math_TAU * size.width), 0, size.width - 1);
+	int y = CLAMP(int(st.y / Math_PI * size.height), 0, size.height - 1);
+	return state->environment->get_pixel(x, y);
+}
+
+bool LightmapperCPU::_light_unshadowed(const Light &p_light, const Vector3 &p_position, const Vector3 &p_normal, Color &r_light, Vector3 &r_light_dir, float &r_dist) const {
+	float attenuation;
+	if (p_light.type == LIGHT_TYPE_DIRECTIONAL) {
+		r_light_dir = -p_light.direction;
+		r_dist = state->world_size;
+		attenuation = 1.0;
+	} else {
+		Vector3 light_vec = p_light.position - p_position;
+		r_dist = light_vec.length();
+		if (r_dist > p_light.range || r_dist < CMP_EPSILON) {
+			return false;
+		}
+		r_light_dir = light_vec / r_dist;
+
+		attenuation = _get_omni_attenuation(r_dist, 1.0 / p_light.range, p_light.attenuation);
+
+		if (p_light.type == LIGHT_TYPE_SPOT) {
+			float cos_angle = (-r_light_dir).dot(p_light.direction);
+			if (cos_angle < p_light.cos_spot_angle) {
+				return false;
+			}
+
+			float scos = MAX(cos_angle, p_light.cos_spot_angle);
+			float spot_rim = MAX(0.0001f, (1.0f - scos) / (1.0f - p_light.cos_spot_angle));
+			attenuation *= 1.0 - Math::pow(spot_rim, p_light.inv_spot_attenuation);
+		}
+	}
+
+	attenuation *= MAX(0.0f, p_normal.dot(r_light_dir));
+	if (attenuation <= 0.0001) {
+		return false;
+	}
+
+	r_light = p_light.color * p_light.energy * attenuation;
+	return true;
+}
+
+Color LightmapperCPU::_trace_direct_light(const Vector3 &p_position, const Vector3 &p_normal) const {
+	// Hard shadows only, this is used at path vertices where soft shadows would not be noticeable.
+	Color direct_light = Color(0, 0, 0);
+	Vector3 origin = p_position + p_normal * state->bias;
+
+	for (const Light &light : lights) {
+		Color light_color;
+		Vector3 light_dir;
+		float dist;
+		if (!_light_unshadowed(light, p_position, p_normal, light_color, light_dir, dist)) {
+			continue;
+		}
+
+		LightmapRaycaster::Ray ray(origin, light_dir, 0.0, dist - state->bias);
+		state->rays_traced.increment();
+		if (!state->raycaster->intersect(ray)) {
+			direct_light += light_color * light.indirect_energy;
+		}
+	}
+
+	return direct_light * state->exposure_normalization;
+}
+
+Color LightmapperCPU::_trace_indirect_light(LightmapRaycaster::Ray &p_ray, uint32_t &r_noise) const {
+	// The lower limit considers the case where bounces are disabled but light probes are requested.
+	int max_depth = MAX(state->bounces, 1);
+	Color throughput = Color(1, 1, 1);
+	Color light = Color(0, 0, 0);
+
+	LightmapRaycaster::Ray &ray = p_ray;
+	for (int depth = 0; depth < max_depth; depth++) {
+		if (!ray) {
+			// Look for the environment color and stop bouncing.
+			light += throughput * _sample_environment(ray.dir);
+			break;
+		}
+
+		Vector3 normal = ray.normal.normalized();
+		if (normal.dot(ray.dir) > 0.0) {
+			break; // Hit a back face, the ray is most likely leaking through geometry.
+		}
+
+		uint32_t texel = _hit_texel(ray);
+		Vector3 position = ray.org + ray.dir * ray.tfar;
+
+		Color direct_light;
+		if (state->texture_for_bounces) {
+			direct_light = state->light_for_bounces[texel];
+		} else {
+			// Trace the lights directly. Significantly more expensive but more accurate in scenarios
+			// where the lightmap texture isn't reliable.
+			direct_light = _trace_direct_light(position, normal);
+		}
+
+		Color albedo = state->albedo[texel];
+		Color emission = state->emission[texel] * state->exposure_normalization;
+
+		light += throughput * emission;
+		throughput *= albedo;
+		light += throughput * direct_light * state->bounce_indirect_energy;
+
+		// Use Russian Roulette to determine a probability to terminate the bounce earlier as an optimization.
+		float p = MAX(MAX(throughput.r, throughput.g), throughput.b);
+		if (depth + 1 == max_depth || _randomize(r_noise) > p) {
+			break;
+		}
+
+		// Boost the throughput from the probability of the ray being terminated early.
+		throughput *= 1.0 / p;
+
+		ray = LightmapRaycaster::Ray(position + normal * state->bias, _generate_ray_dir_from_normal(normal, r_noise), 0.0, state->world_size);
+		state->rays_traced.increment();
+		state->raycaster->intersect(ray);
+	}
+
+	return light;
+}
+
+void LightmapperCPU::_gather_tile_texels(const Tile &p_tile, LocalVector<uint32_t> &r_texels) const {
+	r_texels.clear();
+	for (int y = p_tile.rect.position.y; y < p_tile.rect.get_end().y; y++) {
+		for (int x = p_tile.rect.position.x; x < p_tile.rect.get_end().x; x++) {
+			uint32_t index = _texel_index(p_tile.slice, x, y);
+			if (state->normals[index] != Vector3()) {
+				r_texels.push_back(index);
+			}
+		}
+	}
+}
+
+void LightmapperCPU::_direct_light_tile(uint32_t p_index, uint32_t p_offset) {
+	p_index += p_offset;
+
+	const Tile &tile = state->tiles[p_index];
+	const uint32_t layers = state->bake_sh ? 4 : 1;
+	const uint32_t texels_per_layer = state->atlas_size.width * state->atlas_size.height;
+
+	LocalVector<uint32_t> texels;
+	_gather_tile_texels(tile, texels);
+	if (texels.is_empty()) {
+		return;
+	}
+
+	LocalVector<Color> light_for_texture;
+	light_for_texture.resize(texels.size() * layers);
+	LocalVector<Color> light_for_bounces;
+	light_for_bounces.resize(texels.size());
+	for (uint32_t i = 0; i < texels.size(); i++) {
+		light_for_bounces[i] = Color(0, 0, 0);
+		for (uint32_t j = 0; j < layers; j++) {
+			light_for_texture[i * layers + j] = Color(0, 0, 0);
+		}
+	}
+
+	LocalVector<Color> unshadowed;
+	unshadowed.resize(texels.size());
+	LocalVector<Vector3> light_dirs;
+	light_dirs.resize(texels.size());
+	LocalVector<uint32_t> misses;
+	misses.resize(texels.size());
+
+	// Shadow rays of the whole tile are traced together as one batch per light.
+	Vector<LightmapRaycaster::Ray> rays;
+	LocalVector<uint32_t> ray_texels;
+
+	uint32_t noise = _hash(p_index ^ 43573547u);
+
+	for (const Light &light : lights) {
+		bool soft_shadowing = light.size > 0.0 && light.shadow_blur > 0.0;
+		uint32_t shadow_ray_count = soft_shadowing ? MIN(state->ray_count, (uint32_t)MAX_SOFT_SHADOW_RAYS) : 1;
+
+		rays.clear();
+		ray_texels.clear();
+
+		for (uint32_t i = 0; i < texels.size(); i++) {
+			misses[i] = 0;
+
+			const Vector3 &position = state->positions[texels[i]];
+			const Vector3 &normal = state->normals[texels[i]];
+			float dist;
+			if (!_light_unshadowed(light, position, normal, unshadowed[i], light_dirs[i], dist)) {
+				unshadowed[i] = Color(0, 0, 0);
+				continue;
+			}
+
+			Vector3 origin = position + normal * state->bias;
+			if (!soft_shadowing) {
+				rays.push_back(LightmapRaycaster::Ray(origin, light_dirs[i], 0.0, dist - state->bias));
+				ray_texels.push_back(i);
+				continue;
+			}
+
+			Vector3 aux = light_dirs[i].y > -0.777 ? Vector3(0.0, 1.0, 0.0) : Vector3(1.0, 0.0, 0.0);
+			Vector3 tangent = light_dirs[i].cross(aux).normalized();
+			Vector3 bitangent = light_dirs[i].cross(tangent).normalized();
+			float disk_size = (light.type == LIGHT_TYPE_DIRECTIONAL ? light.size : light.size / dist) * light.shadow_blur;
+
+			for (uint32_t j = 0; j < shadow_ray_count; j++) {
+				float r = _randomize(noise);
+				float a = _randomize(noise) * Math_TAU;
+				Vector2 disk_sample = Vector2(Math::cos(a), Math::sin(a)) * r * disk_size;
+				Vector3 dir = (light_dirs[i] + tangent * disk_sample.x + bitangent * disk_sample.y).normalized();
+				rays.push_back(LightmapRaycaster::Ray(origin, dir, 0.0, dist - state->bias));
+				ray_texels.push_back(i);
+			}
+		}
+
+		state->raycaster->intersect(rays);
+		state->rays_traced.add(rays.size());
+
+		for (int i = 0; i < rays.size(); i++) {
+			if (!rays[i]) {
+				misses[ray_texels[i]]++;
+			}
+		}
+
+		for (uint32_t i = 0; i < texels.size(); i++) {
+			if (misses[i] == 0) {
+				continue;
+			}
+
+			Color lit = unshadowed[i] * (float(misses[i]) / shadow_ray_count);
+			if (light.static_bake) {
+				if (state->bake_sh) {
+					float c[4];
+					_sh_l1_coefficients(light_dirs[i], c);
+					for (uint32_t j = 0; j < 4; j++) {
+						light_for_texture[i * layers + j] += lit * c[j] * 8.0;
+					}
+				} else {
+					light_for_texture[i] += lit;
+				}
+			}
+			light_for_bounces[i] += lit * light.indirect_energy;
+		}
+	}
+
+	for (uint32_t i = 0; i < texels.size(); i++) {
+		uint32_t slice = texels[i] / texels_per_layer;
+		uint32_t offset = texels[i] % texels_per_layer;
+
+		state->light_for_bounces[texels[i]] = light_for_bounces[i] * state->exposure_normalization;
+		for (uint32_t j = 0; j < layers; j++) {
+			state->accum[(slice * layers + j) * texels_per_layer + offset] = light_for_texture[i * layers + j] * state->exposure_normalization;
+		}
+	}
+}
+
+void LightmapperCPU::_bounce_light_tile(uint32_t p_index, uint32_t p_offset) {
+	p_index += p_offset;
+
+	const Tile &tile = state->tiles[p_index];
+	const uint32_t layers = state->bake_sh ? 4 : 1;
+	const uint32_t texels_per_layer = state->atlas_size.width * state->atlas_size.height;
+
+	LocalVector<uint32_t> texels;
+	_gather_tile_texels(tile, texels);
+	if (texels.is_empty()) {
+		return;
+	}
+
+	LocalVector<uint32_t> noise;
+	noise.resize(texels.size());
+	for (uint32_t i = 0; i < texels.size(); i++) {
+		noise[i] = _hash(texels[i] ^ _hash(state->ray_count));
+	}
+
+	LocalVector<Color> light_accum;
+	light_accum.resize(texels.size() * layers);
+	for (Color &c : light_accum) {
+		c = Color(0, 0, 0);
+	}
+
+	// The first segment of every path is traced as one batch per sample for the whole tile, since
+	// neighboring texels shoot rays from nearby positions. Later segments are traced one by one.
+	Vector<LightmapRaycaster::Ray> rays;
+	rays.resize(texels.size());
+	LocalVector<Vector3> ray_dirs;
+	ray_dirs.resize(texels.size());
+
+	for (uint32_t sample = 0; sample < state->ray_count; sample++) {
+		LightmapRaycaster::Ray *rays_ptr = rays.ptrw();
+		for (uint32_t i = 0; i < texels.size(); i++) {
+			const Vector3 &normal = state->normals[texels[i]];
+			ray_dirs[i] = _generate_ray_dir_from_normal(normal, noise[i]);
+			rays_ptr[i] = LightmapRaycaster::Ray(state->positions[texels[i]] + normal * state->bias, ray_dirs[i], 0.0, state->world_size);
+		}
+
+		state->raycaster->intersect(rays);
+		state->rays_traced.add(rays.size());
+
+		rays_ptr = rays.ptrw();
+		for (uint32_t i = 0; i < texels.size(); i++) {
+			Color light = _trace_indirect_light(rays_ptr[i], noise[i]);
+			if (state->bake_sh) {
+				float c[4];
+				_sh_l1_coefficients(ray_dirs[i], c);
+				for (uint32_t j = 0; j < 4; j++) {
+					light_accum[i * layers + j] += light * c[j] * 8.0;
+				}
+			} else {
+				light_accum[i] += light;
+			}
+		}
+	}
+
+	// Add the averaged result to the accumulated light.
+	for (uint32_t i = 0; i < texels.size(); i++) {
+		uint32_t slice = texels[i] / texels_per_layer;
+		uint32_t offset = texels[i] % texels_per_layer;
+		for (uint32_t j = 0; j < layers; j++) {
+			state->accum[(slice * layers + j) * texels_per_layer + offset] += light_accum[i * layers + j] / float(state->ray_count);
+		}
+	}
+}
+
+void LightmapperCPU::_light_probe(uint32_t p_index, uint32_t p_offset) {
+	p_index += p_offset;
+
+	const Vector3 &position = probe_positions[p_index];
+
+	Color probe_sh_accum[9];
+	uint32_t noise = _hash(p_index ^ 49502741u);
+
+	Vector<LightmapRaycaster::Ray> rays;
+	rays.resize(state->probe_ray_count);
+	LocalVector<Vector3> ray_dirs;
+	ray_dirs.resize(state->probe_ray_count);
+
+	LightmapRaycaster::Ray *rays_ptr = rays.ptrw();
+	for (uint32_t i = 0; i < state->probe_ray_count; i++) {
+		ray_dirs[i] = _generate_sphere_uniform_direction(noise);
+		rays_ptr[i] = LightmapRaycaster::Ray(position, ray_dirs[i], 0.0, state->world_size);
+	}
+
+	state->raycaster->intersect(rays);
+	state->rays_traced.add(rays.size());
+
+	rays_ptr = rays.ptrw();
+	for (uint32_t i = 0; i < state->probe_ray_count; i++) {
+		const Vector3 &ray_dir = ray_dirs[i];
+		Color light = _trace_indirect_light(rays_ptr[i], noise);
+
+		float c[9] = {
+			0.282095f, // l0
+			0.488603f * ray_dir.y, // l1n1
+			0.488603f * ray_dir.z, // l1n0
+			0.488603f * ray_dir.x, // l1p1
+			1.092548f * ray_dir.x * ray_dir.y, // l2n2
+			1.092548f * ray_dir.y * ray_dir.z, // l2n1
+			0.315392f * (3.0f * ray_dir.z * ray_dir.z - 1.0f), // l20
+			1.092548f * ray_dir.x * ray_dir.z, // l2p1
+			0.546274f * (ray_dir.x * ray_dir.x - ray_dir.y * ray_dir.y) // l2p2
+		};
+
+		for (uint32_t j = 0; j < 9; j++) {
+			probe_sh_accum[j] += light * c[j];
+		}
+	}
+
+	for (uint32_t j = 0; j < 9; j++) {
+		probe_sh_accum[j] *= 4.0 / float(state->probe_ray_count);
+		probe_sh_accum[j].a = 1.0;
+		probe_values[p_index * 9 + j] = probe_sh_accum[j];
+	}
+}
+
+void LightmapperCPU::_denoise_row(uint32_t p_index, uint32_t p_offset) {
+	// Joint bilateral filter guided by albedo and normals. This is a much cheaper (if less
+	// thorough) stand-in for the JNLM denoiser of LightmapperRD, which is too slow on CPUs.
+	p_index += p_offset;
+
+	const int HALF_WINDOW = 4;
+	const float TWO_SIGMA_SPATIAL_SQUARE = 2.0f * 2.5f * 2.5f;
+	const float TWO_SIGMA_LIGHT_SQUARE = 2.0f * state->denoiser_strength * state->denoiser_strength;
+	const float TWO_SIGMA_ALBEDO_SQUARE = 2.0f * 1.0f * 1.0f;
+	const float TWO_SIGMA_NORMAL_SQUARE = 2.0f * 0.1f * 0.1f;
+
+	const uint32_t layers = state->bake_sh ? 4 : 1;
+	const Size2i size = state->atlas_size;
+	const uint32_t texels_per_layer = size.width * size.height;
+
+	int y = p_index % size.height;
+	uint32_t layer = p_index / size.height;
+	uint32_t slice = layer / layers;
+
+	for (int x = 0; x < size.width; x++) {
+		uint32_t index = _texel_index(slice, x, y);
+		uint32_t accum_index = layer * texels_per_layer + y * size.width + x;
+		const Color &input_light = state->denoise_source[accum_index];
+		const Vector3 &input_normal = state->normals[index];
+		if (input_normal == Vector3()) {
+			state->accum[accum_index] = input_light;
+			continue;
+		}
+		const Color &input_albedo = state->albedo[index];
+
+		Color denoised = Color(0, 0, 0, 0);
+		float sum_weights = 0.0;
+
+		for (int search_y = MAX(y - HALF_WINDOW, 0); search_y <= MIN(y + HALF_WINDOW, size.height - 1); search_y++) {
+			for (int search_x = MAX(x - HALF_WINDOW, 0); search_x <= MIN(x + HALF_WINDOW, size.width - 1); search_x++) {
+				uint32_t search_index = _texel_index(slice, search_x, search_y);
+				const Vector3 &search_normal = state->normals[search_index];
+				if (search_normal == Vector3()) {
+					continue;
+				}
+
+				const Color &search_light = state->denoise_source[layer * texels_per_layer + search_y * size.width + search_x];
+				const Color &search_albedo = state->albedo[search_index];
+
+				float pixel_square_dist = (search_x - x) * (search_x - x) + (search_y - y) * (search_y - y);
+				Vector3 light_delta = Vector3(input_light.r - search_light.r, input_light.g - search_light.g, input_light.b - search_light.b);
+				Vector3 albedo_delta = Vector3(input_albedo.r - search_albedo.r, input_albedo.g - search_albedo.g, input_albedo.b - search_albedo.b);
+
+				float exponent = pixel_square_dist / TWO_SIGMA_SPATIAL_SQUARE;
+				exponent += light_delta.length_squared() / TWO_SIGMA_LIGHT_SQUARE;
+				exponent += albedo_delta.length_squared() / TWO_SIGMA_ALBEDO_SQUARE;
+				exponent += (input_normal - search_normal).length_squared() / TWO_SIGMA_NORMAL_SQUARE;
+				float weight = Math::exp(-exponent);
+
+				denoised += search_light * weight;
+				sum_weights += weight;
+			}
+		}
+
+		state->accum[accum_index] = denoised / sum_weights;
+	}
+}
+
+void LightmapperCPU::_dilate() {
+	// Fill empty texels next to plotted ones, so bilinear filtering doesn't bleed black into the edges.
+	static const Vector2i offsets[] = {
+		// Sides first, as they are closer.
+		Vector2i(-1, 0), Vector2i(0, 1), Vector2i(1, 0), Vector2i(0, -1),
+		// Endpoints second.
+		Vector2i(-1, -1), Vector2i(-1, 1), Vector2i(1, -1), Vector2i(1, 1),
+		// Far sides third.
+		Vector2i(-2, 0), Vector2i(0, 2), Vector2i(2, 0), Vector2i(0, -2),
+		// Far-mid endpoints.
+		Vector2i(-2, -1), Vector2i(-2, 1), Vector2i(2, -1), Vector2i(2, 1),
+		Vector2i(-1, -2), Vector2i(-1, 2), Vector2i(1, -2), Vector2i(1, 2),
+		// Far endpoints.
+		Vector2i(-2, -2), Vector2i(-2, 2), Vector2i(2, -2), Vector2i(2, 2)
+	};
+
+	const uint32_t layers = state->bake_sh ? 4 : 1;
+	const Size2i size = state->atlas_size;
+	const uint32_t texels_per_layer = size.width * size.height;
+
+	LocalVector<Color> source = state->accum;
+
+	for (uint32_t layer = 0; layer < state->atlas_slices * layers; layer++) {
+		uint32_t slice = layer / layers;
+		for (int y = 0; y < size.height; y++) {
+			for (int x = 0; x < size.width; x++) {
+				if (state->normals[_texel_index(slice, x, y)] != Vector3()) {
+					continue;
+				}
+
+				for (const Vector2i &offset : offsets) {
+					Vector2i pos = Vector2i(x, y) + offset;
+					if (pos.x < 0 || pos.y < 0 || pos.x >= size.width || pos.y >= size.height || state->normals[_texel_index(slice, pos.x, pos.y)] == Vector3()) {
+						continue;
+					}
+					state->accum[layer * texels_per_layer + y * size.width + x] = source[layer * texels_per_layer + pos.y * size.width + pos.x];
+					break;
+				}
+			}
+		}
+	}
+}
+
+void LightmapperCPU::_run_in_chunks(TaskMethod p_method, uint32_t p_count, const String &p_description, float p_from, float p_to, BakeStepFunc p_step_function, void *p_bake_userdata) {
+	// Split the work into chunks, so progress can be reported from the calling thread in between.
+	const uint32_t chunk_size = MAX(p_count / 32, 1u);
+	for (uint32_t offset = 0; offset < p_count; offset += chunk_size) {
+		if (p_step_function) {
+			p_step_function(p_from + (p_to - p_from) * float(offset) / p_count, p_description, p_bake_userdata, false);
+		}
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, p_method, offset, MIN(chunk_size, p_count - offset), -1, true, SNAME("LightmapperCPU"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+}
+
+LightmapperCPU::BakeError LightmapperCPU::bake(BakeQuality p_quality, bool p_use_denoiser, float p_denoiser_strength, int p_bounces, float p_bounce_indirect_energy, float p_bias, int p_max_texture_size, bool p_bake_sh, bool p_texture_for_bounces, GenerateProbes p_generate_probes, const Ref<Image> &p_environment_panorama, const Basis &p_environment_transform, BakeStepFunc p_step_function, void *p_bake_userdata, float p_exposure_normalization) {
+	if (p_step_function) {
+		p_step_function(0.0, RTR("Begin Bake"), p_bake_userdata, true);
+	}
+	bake_textures.clear();
+	probe_values.clear();
+
+	BakeState bake_state;
+	bake_state.raycaster = LightmapRaycaster::create();
+	ERR_FAIL_COND_V_MSG(bake_state.raycaster.is_null(), BAKE_ERROR_LIGHTMAP_CANT_PRE_BAKE_MESHES, "The CPU lightmapper requires a LightmapRaycaster implementation, such as the one provided by the raycast module.");
+
+	/* STEP 1: Fit the meshes into the atlas */
+
+	BakeError bake_error = _blit_meshes_into_atlas(p_max_texture_size, bake_state.atlas_size, bake_state.atlas_slices, p_step_function, p_bake_userdata);
+	if (bake_error != BAKE_OK) {
+		return bake_error;
+	}
+
+	state = &bake_state;
+	uint64_t bake_begin = OS::get_singleton()->get_ticks_usec();
+
+	switch (p_quality) {
+		case BAKE_QUALITY_LOW: {
+			bake_state.ray_count = GLOBAL_GET("rendering/lightmapping/bake_quality/low_quality_ray_count");
+			bake_state.probe_ray_count = GLOBAL_GET("rendering/lightmapping/bake_quality/low_quality_probe_ray_count");
+		} break;
+		case BAKE_QUALITY_MEDIUM: {
+			bake_state.ray_count = GLOBAL_GET("rendering/lightmapping/bake_quality/medium_quality_ray_count");
+			bake_state.probe_ray_count = GLOBAL_GET("rendering/lightmapping/bake_quality/medium_quality_probe_ray_count");
+		} break;
+		case BAKE_QUALITY_HIGH: {
+			bake_state.ray_count = GLOBAL_GET("rendering/lightmapping/bake_quality/high_quality_ray_count");
+			bake_state.probe_ray_count = GLOBAL_GET("rendering/lightmapping/bake_quality/high_quality_probe_ray_count");
+		} break;
+		case BAKE_QUALITY_ULTRA: {
+			bake_state.ray_count = GLOBAL_GET("rendering/lightmapping/bake_quality/ultra_quality_ray_count");
+			bake_state.probe_ray_count = GLOBAL_GET("rendering/lightmapping/bake_quality/ultra_quality_probe_ray_count");
+		} break;
+	}
+
+	bake_state.ray_count = CLAMP(bake_state.ray_count, 16u, 8192u);
+	bake_state.probe_ray_count = CLAMP(bake_state.probe_ray_count, 16u, 8192u);
+	bake_state.bake_sh = p_bake_sh;
+	bake_state.texture_for_bounces = p_texture_for_bounces;
+	bake_state.bounces = p_bounces;
+	bake_state.bounce_indirect_energy = p_bounce_indirect_energy;
+	bake_state.bias = p_bias;
+	bake_state.exposure_normalization = p_exposure_normalization;
+	bake_state.denoiser_strength = MAX(p_denoiser_strength, 0.001f);
+	bake_state.environment_transform = p_environment_transform;
+	if (p_environment_panorama.is_valid() && !p_environment_panorama->is_empty()) {
+		bake_state.environment = p_environment_panorama->duplicate();
+		bake_state.environment->convert(Image::FORMAT_RGBAF);
+	}
+
+	const uint32_t layers = p_bake_sh ? 4 : 1;
+	const uint32_t texel_count = bake_state.atlas_size.width * bake_state.atlas_size.height * bake_state.atlas_slices;
+
+	bake_state.positions.resize(texel_count);
+	bake_state.normals.resize(texel_count);
+	bake_state.albedo.resize(texel_count);
+	bake_state.emission.resize(texel_count);
+	bake_state.light_for_bounces.resize(texel_count);
+	bake_state.accum.resize(texel_count * layers);
+	for (uint32_t i = 0; i < texel_count; i++) {
+		bake_state.normals[i] = Vector3();
+		bake_state.light_for_bounces[i] = Color(0, 0, 0);
+	}
+	for (Color &c : bake_state.accum) {
+		c = Color(0, 0, 0);
+	}
+
+	/* STEP 2: Plot the meshes into the atlas and build the acceleration structure */
+
+	_run_in_chunks(&LightmapperCPU::_plot_mesh, mesh_instances.size(), RTR("Plotting meshes into the atlas"), 0.2, 0.3, p_step_function, p_bake_userdata);
+
+	AABB bounds;
+	for (int m_i = 0; m_i < mesh_instances.size(); m_i++) {
+		if (p_step_function) {
+			float p = float(m_i + 1) / mesh_instances.size() * 0.1;
+			p_step_function(0.3 + p, vformat(RTR("Plotting mesh into acceleration structure %d/%d"), m_i + 1, mesh_instances.size()), p_bake_userdata, false);
+		}
+
+		const MeshData &data = mesh_instances[m_i].data;
+		for (int i = 0; i < data.points.size(); i++) {
+			if (m_i == 0 && i == 0) {
+				bounds.position = data.points[0];
+			} else {
+				bounds.expand_to(data.points[i]);
+			}
+		}
+		bake_state.raycaster->add_mesh(data.points, data.normal, data.uv2, m_i);
+	}
+	bake_state.raycaster->commit();
+	bake_state.world_size = MAX(bounds.size.length(), 1.0f);
+
+	// Only tiles that contain plotted texels need to be traced.
+	for (int slice = 0; slice < bake_state.atlas_slices; slice++) {
+		for (int y = 0; y < bake_state.atlas_size.height; y += TILE_SIZE) {
+			for (int x = 0; x < bake_state.atlas_size.width; x += TILE_SIZE) {
+				Tile tile;
+				tile.slice = slice;
+				tile.rect = Rect2i(x, y, TILE_SIZE, TILE_SIZE).intersection(Rect2i(Vector2i(), bake_state.atlas_size));
+
+				bool empty = true;
+				for (int ty = tile.rect.position.y; ty < tile.rect.get_end().y && empty; ty++) {
+					for (int tx = tile.rect.position.x; tx < tile.rect.get_end().x; tx++) {
+						if (bake_state.normals[_texel_index(slice, tx, ty)] != Vector3()) {
+							empty = false;
+							break;
+						}
+					}
+				}
+				if (!empty) {
+					bake_state.tiles.push_back(tile);
+				}
+			}
+		}
+	}
+
+	/* STEP 3: Direct light */
+
+	_run_in_chunks(&LightmapperCPU::_direct_light_tile, bake_state.tiles.size(), RTR("Plot direct lighting"), 0.4, 0.5, p_step_function, p_bake_userdata);
+
+	/* STEP 4: Indirect light */
+
+	if (p_bounces > 0) {
+		_run_in_chunks(&LightmapperCPU::_bounce_light_tile, bake_state.tiles.size(), RTR("Integrate indirect lighting"), 0.5, 0.8, p_step_function, p_bake_userdata);
+	}
+
+	/* STEP 5: Light probes */
+
+	if (probe_positions.size() > 0) {
+		probe_values.resize(probe_positions.size() * 9);
+		_run_in_chunks(&LightmapperCPU::_light_probe, probe_positions.size(), RTR("Integrate light probes"), 0.8, 0.85, p_step_function, p_bake_userdata);
+	}
+
+	/* STEP 6: Denoise and dilate */
+
+	if (p_use_denoiser) {
+		bake_state.denoise_source = bake_state.accum;
+		_run_in_chunks(&LightmapperCPU::_denoise_row, bake_state.atlas_slices * layers * bake_state.atlas_size.height, RTR("Denoising"), 0.85, 0.9, p_step_function, p_bake_userdata);
+		bake_state.denoise_source.clear();
+	}
+
+	if (p_step_function) {
+		p_step_function(0.9, RTR("Dilating"), p_bake_userdata, true);
+	}
+	_dilate();
+
+	if (p_step_function) {
+		p_step_function(0.95, RTR("Retrieving textures"), p_bake_userdata, true);
+	}
+
+	const uint32_t texels_per_layer = bake_state.atlas_size.width * bake_state.atlas_size.height;
+	for (uint32_t layer = 0; layer < bake_state.atlas_slices * layers; layer++) {
+		Vector<uint8_t> data;
+		data.resize(texels_per_layer * sizeof(Color));
+		memcpy(data.ptrw(), &bake_state.accum[layer * texels_per_layer], texels_per_layer * sizeof(Color));
+
+		Ref<Image> img = Image::create_from_data(bake_state.atlas_size.width, bake_state.atlas_size.height, false, Image::FORMAT_RGBAF, data);
+		img->convert(Image::FORMAT_RGBH); // Remove alpha and match the format of LightmapperRD.
+		bake_textures.push_back(img);
+	}
+
+	uint64_t rays_traced = bake_state.rays_traced.get();
+	double bake_seconds = (OS::get_singleton()->get_ticks_usec() - bake_begin) / 1000000.0;
+	print_verbose(vformat("LightmapperCPU: Traced %d rays in %.2f seconds (%.2f million rays per second) over %d tiles.", rays_traced, bake_seconds, rays_traced / MAX(bake_seconds, 0.000001) / 1000000.0, bake_state.tiles.size()));
+
+	state = nullptr;
+
+	return BAKE_OK;
+}
+
+int LightmapperCPU::get_bake_texture_count() const {
+	return bake_textures.size();
+}
+
+Ref<Image> LightmapperCPU::get_bake_texture(int p_index) const {
+	ERR_FAIL_INDEX_V(p_index, bake_textures.size(), Ref<Image>());
+	return bake_textures[p_index];
+}
+
+int LightmapperCPU::get_bake_mesh_count() const {
+	return mesh_instances.size();
+}
+
+Variant LightmapperCPU::get_bake_mesh_userdata(int p_index) const {
+	ERR_FAIL_INDEX_V(p_index, mesh_instances.size(), Variant());
+	return mesh_instances[p_index].data.userdata;
+}
+
+Rect2 LightmapperCPU::get_bake_mesh_uv_scale(int p_index) const {
+	ERR_FAIL_COND_V(bake_textures.size() == 0, Rect2());
+	ERR_FAIL_INDEX_V(p_index, mesh_instances.size(), Rect2());
+	Rect2 uv_ofs;
+	Vector2 atlas_size = Vector2(bake_textures[0]->get_width(), bake_textures[0]->get_height());
+	uv_ofs.position = Vector2(mesh_instances[p_index].offset) / atlas_size;
+	uv_ofs.size = Vector2(mesh_instances[p_index].data.albedo_on_uv2->get_width(), mesh_instances[p_index].data.albedo_on_uv2->get_height()) / atlas_size;
+	return uv_ofs;
+}
+
+int LightmapperCPU::get_bake_mesh_texture_slice(int p_index) const {
+	ERR_FAIL_INDEX_V(p_index, mesh_instances.size(), 0);
+	return mesh_instances[p_index].slice;
+}
+
+int LightmapperCPU::get_bake_probe_count() const {
+	return probe_positions.size();
+}
+
+Vector3 LightmapperCPU::get_bake_probe_point(int p_probe) const {
+	ERR_FAIL_INDEX_V(p_probe, probe_positions.size(), Vector3());
+	return probe_positions[p_probe];
+}
+
+Vector<Color> LightmapperCPU::get_bake_probe_sh(int p_probe) const {
+	ERR_FAIL_INDEX_V(p_probe, probe_positions.size(), Vector<Color>());
+	Vector<Color> ret;
+	ret.resize(9);
+	memcpy(ret.ptrw(), &probe_values[p_probe * 9], sizeof(Color) * 9);
+	return ret;
+}
+
+LightmapperCPU::LightmapperCPU() {
+}
@@ -0,0 +1,167 @@
+/**************************************************************************/
+/*  lightmapper_cpu.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef LIGHTMAPPER_CPU_H
+#define LIGHTMAPPER_CPU_H
+
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+#include "scene/3d/lightmapper.h"
+
+class LightmapperCPU : public Lightmapper {
+	GDCLASS(LightmapperCPU, Lightmapper)
+
+	friend class TestLightmapperCPUAccessor;
+
+	struct MeshInstance {
+		MeshData data;
+		int slice = 0;
+		Vector2i offset;
+	};
+
+	struct Light {
+		LightType type = LIGHT_TYPE_DIRECTIONAL;
+		Vector3 position;
+		Vector3 direction;
+		Color color;
+		float energy = 0.0;
+		float indirect_energy = 0.0;
+		float size = 0.0;
+		float range = 0.0;
+		float attenuation = 0.0;
+		float cos_spot_angle = 0.0;
+		float inv_spot_attenuation = 0.0;
+		float shadow_blur = 0.0;
+		bool static_bake = false;
+	};
+
+	// Texels are processed in square tiles, which keeps the rays of a batch spatially coherent.
+	struct Tile {
+		int slice = 0;
+		Rect2i rect;
+	};
+
+	enum {
+		TILE_SIZE = 16,
+		MAX_SOFT_SHADOW_RAYS = 64,
+	};
+
+	// State shared by the worker threads during a bake. Everything that is written per texel is
+	// indexed by tile, so no synchronization is needed besides the ray counter.
+	struct BakeState {
+		Ref<LightmapRaycaster> raycaster;
+
+		Size2i atlas_size;
+		int atlas_slices = 0;
+		LocalVector<Tile> tiles;
+
+		// One entry per atlas texel, slice-major. A zero normal marks an empty texel.
+		LocalVector<Vector3> positions;
+		LocalVector<Vector3> normals;
+		LocalVector<Color> albedo;
+		LocalVector<Color> emission;
+		LocalVector<Color> light_for_bounces;
+		// One entry per texel, or four (L0 and L1 SH bands, as consecutive layers) when baking SH.
+		LocalVector<Color> accum;
+
+		Ref<Image> environment;
+		Basis environment_transform;
+
+		bool bake_sh = false;
+		bool texture_for_bounces = false;
+		uint32_t ray_count = 0;
+		uint32_t probe_ray_count = 0;
+		int bounces = 0;
+		float bounce_indirect_energy = 0.0;
+		float bias = 0.0;
+		float exposure_normalization = 1.0;
+		float world_size = 0.0;
+		float denoiser_strength = 0.0;
+		LocalVector<Color> denoise_source;
+
+		SafeNumeric<uint64_t> rays_traced;
+	};
+
+	Vector<MeshInstance> mesh_instances;
+	Vector<Light> lights;
+	Vector<Vector3> probe_positions;
+
+	Vector<Ref<Image>> bake_textures;
+	LocalVector<Color> probe_values;
+
+	BakeState *state = nullptr;
+
+	typedef void (LightmapperCPU::*TaskMethod)(uint32_t, uint32_t);
+	void _run_in_chunks(TaskMethod p_method, uint32_t p_count, const String &p_description, float p_from, float p_to, BakeStepFunc p_step_function, void *p_bake_userdata);
+
+	BakeError _blit_meshes_into_atlas(int p_max_texture_size, Size2i &r_atlas_size, int &r_atlas_slices, BakeStepFunc p_step_function, void *p_bake_userdata);
+
+	_FORCE_INLINE_ uint32_t _texel_index(int p_slice, int p_x, int p_y) const {
+		return (p_slice * state->atlas_size.height + p_y) * state->atlas_size.width + p_x;
+	}
+	uint32_t _hit_texel(const LightmapRaycaster::Ray &p_ray) const;
+	void _gather_tile_texels(const Tile &p_tile, LocalVector<uint32_t> &r_texels) const;
+	Color _sample_environment(const Vector3 &p_dir) const;
+
+	bool _light_unshadowed(const Light &p_light, const Vector3 &p_position, const Vector3 &p_normal, Color &r_light, Vector3 &r_light_dir, float &r_dist) const;
+	Color _trace_direct_light(const Vector3 &p_position, const Vector3 &p_normal) const;
+	Color _trace_indirect_light(LightmapRaycaster::Ray &p_ray, uint32_t &r_noise) const;
+
+	// Worker thread tasks, p_offset is the first index of the chunk being processed.
+	void _plot_mesh(uint32_t p_index, uint32_t p_offset);
+	void _direct_light_tile(uint32_t p_index, uint32_t p_offset);
+	void _bounce_light_tile(uint32_t p_index, uint32_t p_offset);
+	void _light_probe(uint32_t p_index, uint32_t p_offset);
+	void _denoise_row(uint32_t p_index, uint32_t p_offset);
+
+	void _dilate();
+
+public:
+	virtual void add_mesh(const MeshData &p_mesh) override;
+	virtual void add_directional_light(bool p_static, const Vector3 &p_direction, const Color &p_color, float p_energy, float p_indirect_energy, float p_angular_distance, float p_shadow_blur) override;
+	virtual void add_omni_light(bool p_static, const Vector3 &p_position, const Color &p_color, float p_energy, float p_indirect_energy, float p_range, float p_attenuation, float p_size, float p_shadow_blur) override;
+	virtual void add_spot_light(bool p_static, const Vector3 &p_position, const Vector3 p_direction, const Color &p_color, float p_energy, float p_indirect_energy, float p_range, float p_attenuation, float p_spot_angle, float p_spot_attenuation, float p_size, float p_shadow_blur) override;
+	virtual void add_probe(const Vector3 &p_position) override;
+	virtual BakeError bake(BakeQuality p_quality, bool p_use_denoiser, float p_denoiser_strength, int p_bounces, float p_bounce_indirect_energy, float p_bias, int p_max_texture_size, bool p_bake_sh, bool p_texture_for_bounces, GenerateProbes p_generate_probes, const Ref<Image> &p_environment_panorama, const Basis &p_environment_transform, BakeStepFunc p_step_function = nullptr, void *p_bake_userdata = nullptr, float p_exposure_normalization = 1.0) override;
+
+	int get_bake_texture_count() const override;
+	Ref<Image> get_bake_texture(int p_index) const override;
+	int get_bake_mesh_count() const override;
+	Variant get_bake_mesh_userdata(int p_index) const override;
+	Rect2 get_bake_mesh_uv_scale(int p_index) const override;
+	int get_bake_mesh_texture_slice(int p_index) const override;
+	int get_bake_probe_count() const override;
+	Vector3 get_bake_probe_point(int p_probe) const override;
+	Vector<Color> get_bake_probe_sh(int p_probe) const override;
+
+	LightmapperCPU();
+};
+
+#endif // LIGHTMAPPER_CPU_H
@@ -0,0 +1,247 @@
+/**************************************************************************/
+/*  test_lightmapper_cpu.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_LIGHTMAPPER_CPU_H
+#define TEST_LIGHTMAPPER_CPU_H
+
+#include "../lightmapper_cpu.h"
+
+#include "core/os/os.h"
+
+#include "tests/test_macros.h"
+
+class TestLightmapperCPUAccessor {
+	static void _init_state(LightmapperCPU::BakeState &r_state, const Size2i &p_size, const LocalVector<Vector3> &p_normals, const LocalVector<Color> &p_albedo, const LocalVector<Color> &p_light) {
+		r_state.atlas_size = p_size;
+		r_state.atlas_slices = 1;
+		r_state.normals = p_normals;
+		r_state.albedo = p_albedo;
+		r_state.accum = p_light;
+	}
+
+public:
+	// Runs the post-processing passes on a single slice atlas, without tracing any rays.
+	static LocalVector<Color> dilate(const Size2i &p_size, const LocalVector<Vector3> &p_normals, const LocalVector<Color> &p_light) {
+		Ref<LightmapperCPU> lightmapper;
+		lightmapper.instantiate();
+		LightmapperCPU::BakeState state;
+		LocalVector<Color> albedo;
+		albedo.resize(p_normals.size());
+		_init_state(state, p_size, p_normals, albedo, p_light);
+
+		lightmapper->state = &state;
+		lightmapper->_dilate();
+		lightmapper->state = nullptr;
+		return state.accum;
+	}
+
+	static LocalVector<Color> denoise(const Size2i &p_size, const LocalVector<Vector3> &p_normals, const LocalVector<Color> &p_albedo, const LocalVector<Color> &p_light, float p_strength) {
+		Ref<LightmapperCPU> lightmapper;
+		lightmapper.instantiate();
+		LightmapperCPU::BakeState state;
+		_init_state(state, p_size, p_normals, p_albedo, p_light);
+		state.denoiser_strength = p_strength;
+		state.denoise_source = p_light;
+
+		lightmapper->state = &state;
+		for (int y = 0; y < p_size.height; y++) {
+			lightmapper->_denoise_row(y, 0);
+		}
+		lightmapper->state = nullptr;
+		return state.accum;
+	}
+};
+
+namespace TestLightmapperCPU {
+
+static Lightmapper::MeshData make_quad(const Vector3 &p_center, const Vector2 &p_size, int p_lightmap_size) {
+	const Vector3 corners[4] = {
+		p_center + Vector3(-p_size.x, 0, -p_size.y) * 0.5,
+		p_center + Vector3(p_size.x, 0, -p_size.y) * 0.5,
+		p_center + Vector3(p_size.x, 0, p_size.y) * 0.5,
+		p_center + Vector3(-p_size.x, 0, p_size.y) * 0.5,
+	};
+	const Vector2 uvs[4] = { Vector2(0, 0), Vector2(1, 0), Vector2(1, 1), Vector2(0, 1) };
+	const int triangles[6] = { 0, 1, 2, 0, 2, 3 };
+
+	Lightmapper::MeshData mesh;
+	for (int i : triangles) {
+		mesh.points.push_back(corners[i]);
+		mesh.uv2.push_back(uvs[i]);
+		mesh.normal.push_back(Vector3(0, 1, 0));
+	}
+	mesh.albedo_on_uv2 = Image::create_empty(p_lightmap_size, p_lightmap_size, false, Image::FORMAT_RGBA8);
+	mesh.albedo_on_uv2->fill(Color(1, 1, 1));
+	mesh.emission_on_uv2 = Image::create_empty(p_lightmap_size, p_lightmap_size, false, Image::FORMAT_RGBA8);
+	mesh.emission_on_uv2->fill(Color(0, 0, 0));
+	return mesh;
+}
+
+static Color get_baked_light(const Ref<LightmapperCPU> &p_lightmapper, int p_mesh, const Vector2 &p_uv) {
+	Ref<Image> texture = p_lightmapper->get_bake_texture(p_lightmapper->get_bake_mesh_texture_slice(p_mesh));
+	Rect2 uv_scale = p_lightmapper->get_bake_mesh_uv_scale(p_mesh);
+	Vector2 atlas_uv = uv_scale.position + p_uv * uv_scale.size;
+	return texture->get_pixel(atlas_uv.x * texture->get_width(), atlas_uv.y * texture->get_height());
+}
+
+TEST_CASE("[LightmapperCPU] Dilation fills empty texels next to plotted ones") {
+	const Size2i size = Size2i(8, 8);
+	LocalVector<Vector3> normals;
+	LocalVector<Color> light;
+	normals.resize(size.width * size.height);
+	light.resize(size.width * size.height);
+	for (uint32_t i = 0; i < normals.size(); i++) {
+		normals[i] = Vector3();
+		light[i] = Color(0, 0, 0);
+	}
+	// A single plotted texel.
+	normals[3 * size.width + 3] = Vector3(0, 1, 0);
+	light[3 * size.width + 3] = Color(1, 0.5, 0.25);
+
+	LocalVector<Color> dilated = TestLightmapperCPUAccessor::dilate(size, normals, light);
+
+	CHECK(dilated[3 * size.width + 3] == Color(1, 0.5, 0.25));
+	CHECK_MESSAGE(dilated[3 * size.width + 2] == Color(1, 0.5, 0.25), "Side neighbors should be filled.");
+	CHECK_MESSAGE(dilated[4 * size.width + 4] == Color(1, 0.5, 0.25), "Diagonal neighbors should be filled.");
+	CHECK_MESSAGE(dilated[5 * size.width + 1] == Color(1, 0.5, 0.25), "Texels two texels away should be filled.");
+	CHECK_MESSAGE(dilated[6 * size.width + 3] == Color(0, 0, 0), "Texels more than two texels away should be left empty.");
+	CHECK(dilated[0] == Color(0, 0, 0));
+}
+
+TEST_CASE("[LightmapperCPU] Denoising smooths noise and preserves normal edges") {
+	const Size2i size = Size2i(16, 16);
+	LocalVector<Vector3> normals;
+	LocalVector<Color> albedo;
+	LocalVector<Color> light;
+	normals.resize(size.width * size.height);
+	albedo.resize(size.width * size.height);
+	light.resize(size.width * size.height);
+
+	// The left half faces up and is lit with a noisy checkerboard, the right half faces sideways and is dark.
+	// The bottom row is left empty.
+	for (int y = 0; y < size.height; y++) {
+		for (int x = 0; x < size.width; x++) {
+			uint32_t i = y * size.width + x;
+			albedo[i] = Color(1, 1, 1);
+			if (y == size.height - 1) {
+				normals[i] = Vector3();
+				light[i] = Color(0.25, 0.25, 0.25);
+			} else if (x < size.width / 2) {
+				normals[i] = Vector3(0, 1, 0);
+				float value = (x + y) % 2 ? 0.6 : 0.4;
+				light[i] = Color(value, value, value);
+			} else {
+				normals[i] = Vector3(1, 0, 0);
+				light[i] = Color(0, 0, 0);
+			}
+		}
+	}
+
+	LocalVector<Color> denoised = TestLightmapperCPUAccessor::denoise(size, normals, albedo, light, 1.0);
+
+	float noise_before = 0.0;
+	float noise_after = 0.0;
+	for (int y = 0; y < size.height - 1; y++) {
+		for (int x = 0; x < size.width / 2; x++) {
+			uint32_t i = y * size.width + x;
+			noise_before += Math::abs(light[i].r - 0.5);
+			noise_after += Math::abs(denoised[i].r - 0.5);
+		}
+	}
+	CHECK_MESSAGE(noise_after < noise_before * 0.25, "Noise should be smoothed out.");
+
+	for (int y = 0; y < size.height - 1; y++) {
+		uint32_t left = y * size.width + size.width / 2 - 1;
+		uint32_t right = left + 1;
+		CHECK_MESSAGE(denoised[left].r > 0.45, "Light shouldn't leak across normal edges.");
+		CHECK_MESSAGE(denoised[right].r < 0.01, "Light shouldn't leak across normal edges.");
+	}
+
+	for (int x = 0; x < size.width; x++) {
+		uint32_t i = (size.height - 1) * size.width + x;
+		CHECK_MESSAGE(denoised[i] == Color(0.25, 0.25, 0.25), "Empty texels should be left untouched.");
+	}
+}
+
+TEST_CASE("[LightmapperCPU] Bake a small scene with a shadow caster") {
+	if (LightmapRaycaster::create().is_null()) {
+		MESSAGE("Skipping, no LightmapRaycaster implementation is available in this build.");
+		return;
+	}
+
+	Ref<LightmapperCPU> lightmapper;
+	lightmapper.instantiate();
+	// A floor, with a caster above its left half.
+	lightmapper->add_mesh(make_quad(Vector3(), Vector2(4, 4), 32));
+	lightmapper->add_mesh(make_quad(Vector3(-1, 1, 0), Vector2(2, 4), 16));
+	lightmapper->add_directional_light(true, Vector3(0, -1, 0), Color(1, 1, 1), 1.0, 1.0, 0.0, 0.0);
+
+	Lightmapper::BakeError err = lightmapper->bake(Lightmapper::BAKE_QUALITY_LOW, false, 0.1, 0, 0.0, 0.005, 512, false, false, Lightmapper::GENERATE_PROBES_DISABLED, Ref<Image>(), Basis());
+	REQUIRE(err == Lightmapper::BAKE_OK);
+	REQUIRE(lightmapper->get_bake_texture_count() >= 1);
+	CHECK(lightmapper->get_bake_mesh_count() == 2);
+
+	Color lit = get_baked_light(lightmapper, 0, Vector2(0.75, 0.5));
+	Color shadowed = get_baked_light(lightmapper, 0, Vector2(0.25, 0.5));
+	CHECK_MESSAGE(lit.r == doctest::Approx(1.0).epsilon(0.05), "The uncovered half of the floor should be fully lit.");
+	CHECK_MESSAGE(shadowed.r < 0.05, "The covered half of the floor should be in shadow.");
+	CHECK_MESSAGE(get_baked_light(lightmapper, 1, Vector2(0.5, 0.5)).r == doctest::Approx(1.0).epsilon(0.05), "The caster should be fully lit.");
+}
+
+TEST_CASE("[LightmapperCPU][Benchmark] Bake" * doctest::skip()) {
+	if (LightmapRaycaster::create().is_null()) {
+		return;
+	}
+
+	const int grid_size = 8;
+
+	Ref<LightmapperCPU> lightmapper;
+	lightmapper.instantiate();
+	lightmapper->add_mesh(make_quad(Vector3(), Vector2(grid_size * 2, grid_size * 2), 256));
+	for (int x = 0; x < grid_size; x++) {
+		for (int z = 0; z < grid_size; z++) {
+			lightmapper->add_mesh(make_quad(Vector3(x * 2 - grid_size + 1, 0.5 + (x + z) % 3, z * 2 - grid_size + 1), Vector2(1, 1), 32));
+		}
+	}
+	lightmapper->add_directional_light(true, Vector3(1, -2, 0.5).normalized(), Color(1, 1, 1), 1.0, 1.0, 2.0, 1.0);
+	lightmapper->add_omni_light(true, Vector3(0, 3, 0), Color(1, 0.8, 0.6), 2.0, 1.0, 10.0, 1.0, 0.5, 1.0);
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	Lightmapper::BakeError err = lightmapper->bake(Lightmapper::BAKE_QUALITY_MEDIUM, true, 0.1, 3, 1.0, 0.005, 2048, false, false, Lightmapper::GENERATE_PROBES_DISABLED, Ref<Image>(), Basis());
+	uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+	REQUIRE(err == Lightmapper::BAKE_OK);
+
+	Ref<Image> texture = lightmapper->get_bake_texture(0);
+	MESSAGE(vformat("%d meshes baked into %d %dx%d textures in %.2f msec.", lightmapper->get_bake_mesh_count(), lightmapper->get_bake_texture_count(), texture->get_width(), texture->get_height(), elapsed / 1000.0));
+}
+
+} // namespace TestLightmapperCPU
+
+#endif // TEST_LIGHTMAPPER_CPU_H
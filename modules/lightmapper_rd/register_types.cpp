@@ -37,6 +37,10 @@
 
 #ifndef _3D_DISABLED
 static Lightmapper *create_lightmapper_rd() {
+	if (!RenderingDevice::get_singleton()) {
+		// No GPU to bake with (e.g. headless), let the CPU lightmapper take over if available.
+		return nullptr;
+	}
 	return memnew(LightmapperRD);
 }
 #endif
@@ -46,17 +50,9 @@ void initialize_lightmapper_rd_module(ModuleInitializationLevel p_level) {
 		return;
 	}
 
-	GLOBAL_DEF("rendering/lightmapping/bake_quality/low_quality_ray_count", 32);
-	GLOBAL_DEF("rendering/lightmapping/bake_quality/medium_quality_ray_count", 128);
-	GLOBAL_DEF("rendering/lightmapping/bake_quality/high_quality_ray_count", 512);
-	GLOBAL_DEF("rendering/lightmapping/bake_quality/ultra_quality_ray_count", 2048);
 	GLOBAL_DEF("rendering/lightmapping/bake_performance/max_rays_per_pass", 32);
 	GLOBAL_DEF("rendering/lightmapping/bake_performance/region_size", 512);
 
-	GLOBAL_DEF("rendering/lightmapping/bake_quality/low_quality_probe_ray_count", 64);
-	GLOBAL_DEF("rendering/lightmapping/bake_quality/medium_quality_probe_ray_count", 256);
-	GLOBAL_DEF("rendering/lightmapping/bake_quality/high_quality_probe_ray_count", 512);
-	GLOBAL_DEF("rendering/lightmapping/bake_quality/ultra_quality_probe_ray_count", 2048);
 	GLOBAL_DEF("rendering/lightmapping/bake_performance/max_rays_per_probe_pass", 64);
 
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/lightmapping/denoising/denoiser", PROPERTY_HINT_ENUM, "JNLM,OIDN"), 0);
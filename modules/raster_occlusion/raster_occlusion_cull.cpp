@@ -0,0 +1,396 @@
+/**************************************************************************/
+/*  raster_occlusion_cull.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "raster_occlusion_cull.h"
+
+#include "core/object/worker_thread_pool.h"
+
+void RasterOcclusionCull::RasterHZBuffer::clear() {
+	HZBuffer::clear();
+
+	view_vertices.reset();
+	triangles.reset();
+	bins.reset();
+}
+
+void RasterOcclusionCull::RasterHZBuffer::resize(const Size2i &p_size) {
+	if (p_size == Size2i()) {
+		clear();
+		return;
+	}
+
+	if (!sizes.is_empty() && p_size == sizes[0]) {
+		return; // Size didn't change
+	}
+
+	HZBuffer::resize(p_size);
+
+	bins.resize((p_size.y + BAND_HEIGHT - 1) / BAND_HEIGHT);
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_setup_triangle(const Vector3 &p_a, const Vector3 &p_b, const Vector3 &p_c, const Projection &p_cam_projection, bool p_orthogonal) {
+	const Size2i &buffer_size = sizes[0];
+	const Vector3 *view[3] = { &p_a, &p_b, &p_c };
+
+	ScreenTriangle tri;
+	for (int i = 0; i < 3; i++) {
+		Plane projected = p_cam_projection.xform4(Plane(*view[i], 1.0));
+		float w = projected.d;
+		tri.points[i] = Vector2((projected.normal.x / w * 0.5f + 0.5f) * buffer_size.x, (projected.normal.y / w * 0.5f + 0.5f) * buffer_size.y);
+
+		float depth = -view[i]->z;
+		tri.depths[i] = p_orthogonal ? depth : 1.0f / depth;
+	}
+
+	float area = (tri.points[1] - tri.points[0]).cross(tri.points[2] - tri.points[0]);
+	if (Math::is_zero_approx(area)) {
+		return;
+	}
+	if (area < 0) {
+		// Keep a single winding, so that inside points have positive edge functions.
+		SWAP(tri.points[1], tri.points[2]);
+		SWAP(tri.depths[1], tri.depths[2]);
+	}
+
+	// Pixels whose center lies inside the bounding rectangle.
+	Vector2 rect_min = tri.points[0].min(tri.points[1]).min(tri.points[2]);
+	Vector2 rect_max = tri.points[0].max(tri.points[1]).max(tri.points[2]);
+	tri.min_x = CLAMP(Math::ceil(rect_min.x - 0.5f), 0, buffer_size.x);
+	tri.max_x = CLAMP(Math::floor(rect_max.x - 0.5f), -1, buffer_size.x - 1);
+	tri.min_y = CLAMP(Math::ceil(rect_min.y - 0.5f), 0, buffer_size.y);
+	tri.max_y = CLAMP(Math::floor(rect_max.y - 0.5f), -1, buffer_size.y - 1);
+
+	if (tri.min_x > tri.max_x || tri.min_y > tri.max_y) {
+		return;
+	}
+
+	uint32_t index = triangles.size();
+	triangles.push_back(tri);
+
+	for (int i = tri.min_y / BAND_HEIGHT; i <= tri.max_y / BAND_HEIGHT; i++) {
+		bins[i].push_back(index);
+	}
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_clip_and_setup_triangle(const Vector3 &p_a, const Vector3 &p_b, const Vector3 &p_c, float p_near, const Projection &p_cam_projection, bool p_orthogonal) {
+	const Vector3 *view[3] = { &p_a, &p_b, &p_c };
+
+	// Clip against the near plane, which leaves at most 4 vertices.
+	Vector3 clipped[4];
+	int clipped_count = 0;
+
+	for (int i = 0; i < 3; i++) {
+		const Vector3 &current = *view[i];
+		const Vector3 &next = *view[(i + 1) % 3];
+		bool current_inside = current.z <= -p_near;
+		bool next_inside = next.z <= -p_near;
+
+		if (current_inside) {
+			clipped[clipped_count++] = current;
+		}
+		if (current_inside != next_inside) {
+			float t = (-p_near - current.z) / (next.z - current.z);
+			clipped[clipped_count] = current.lerp(next, t);
+			clipped[clipped_count].z = -p_near;
+			clipped_count++;
+		}
+	}
+
+	if (clipped_count < 3) {
+		return;
+	}
+
+	_setup_triangle(clipped[0], clipped[1], clipped[2], p_cam_projection, p_orthogonal);
+	if (clipped_count == 4) {
+		_setup_triangle(clipped[0], clipped[2], clipped[3], p_cam_projection, p_orthogonal);
+	}
+}
+
+void RasterOcclusionCull::RasterHZBuffer::_rasterize_band_threaded(uint32_t p_band, const RasterThreadData *p_data) {
+	const Size2i &buffer_size = sizes[0];
+	int from_y = p_band * BAND_HEIGHT;
+	int to_y = MIN(from_y + BAND_HEIGHT, buffer_size.y) - 1;
+
+	float *depth_buffer = mips[0];
+	for (int i = from_y * buffer_size.x; i < (to_y + 1) * buffer_size.x; i++) {
+		depth_buffer[i] = FLT_MAX;
+	}
+
+	for (uint32_t index : bins[p_band]) {
+		const ScreenTriangle &tri = triangles[index];
+		const Vector2 &p0 = tri.points[0];
+		const Vector2 &p1 = tri.points[1];
+		const Vector2 &p2 = tri.points[2];
+
+		// Edge functions, each one is the (doubled) area of the sub-triangle opposite to a vertex.
+		// Evaluated at pixel centers, they are all positive for pixels inside the triangle.
+		float inv_area = 1.0f / (p1 - p0).cross(p2 - p0);
+		float step_x0 = -(p2.y - p1.y);
+		float step_x1 = -(p0.y - p2.y);
+		float step_x2 = -(p1.y - p0.y);
+
+		int min_y = MAX(tri.min_y, from_y);
+		int max_y = MIN(tri.max_y, to_y);
+		float first_x = tri.min_x + 0.5f;
+
+		for (int y = min_y; y <= max_y; y++) {
+			float *row = &depth_buffer[y * buffer_size.x];
+			float py = y + 0.5f;
+
+			float edge0 = (p2.x - p1.x) * (py - p1.y) - (p2.y - p1.y) * (first_x - p1.x);
+			float edge1 = (p0.x - p2.x) * (py - p2.y) - (p0.y - p2.y) * (first_x - p2.x);
+			float edge2 = (p1.x - p0.x) * (py - p0.y) - (p1.y - p0.y) * (first_x - p0.x);
+
+			// Branch-free, so that the compiler can vectorize the span.
+			for (int x = tri.min_x; x <= tri.max_x; x++) {
+				float offset = x - tri.min_x;
+				float w0 = edge0 + step_x0 * offset;
+				float w1 = edge1 + step_x1 * offset;
+				float w2 = edge2 + step_x2 * offset;
+
+				float interpolated = (w0 * tri.depths[0] + w1 * tri.depths[1] + w2 * tri.depths[2]) * inv_area;
+				float depth = p_data->orthogonal ? interpolated : 1.0f / interpolated;
+				bool inside = w0 >= 0.0f && w1 >= 0.0f && w2 >= 0.0f;
+				row[x] = (inside && depth < row[x]) ? depth : row[x];
+			}
+		}
+	}
+}
+
+void RasterOcclusionCull::RasterHZBuffer::rasterize(const Vector3 *p_vertices, uint32_t p_vertex_count, const uint32_t *p_indices, uint32_t p_index_count, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	ERR_FAIL_COND(is_empty());
+
+	float z_near = p_cam_projection.get_z_near();
+	debug_tex_range = p_cam_projection.get_z_far();
+
+	Transform3D cam_inv_transform = p_cam_transform.affine_inverse();
+	view_vertices.resize(p_vertex_count);
+	for (uint32_t i = 0; i < p_vertex_count; i++) {
+		view_vertices[i] = cam_inv_transform.xform(p_vertices[i]);
+	}
+
+	triangles.clear();
+	for (LocalVector<uint32_t> &bin : bins) {
+		bin.clear();
+	}
+
+	for (uint32_t i = 0; i + 2 < p_index_count; i += 3) {
+		_clip_and_setup_triangle(view_vertices[p_indices[i]], view_vertices[p_indices[i + 1]], view_vertices[p_indices[i + 2]], z_near, p_cam_projection, p_cam_orthogonal);
+	}
+
+	RasterThreadData td;
+	td.orthogonal = p_cam_orthogonal;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RasterHZBuffer::_rasterize_band_threaded, (const RasterThreadData *)&td, bins.size(), -1, true, SNAME("RasterOcclusionCullRasterize"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	update_mips();
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::Scenario::update(RID_PtrOwner<Occluder> &p_occluder_owner) {
+	if (!dirty) {
+		return;
+	}
+	dirty = false;
+
+	vertices.clear();
+	indices.clear();
+
+	for (const KeyValue<RID, OccluderInstance> &E : instances) {
+		const OccluderInstance &instance = E.value;
+		if (!instance.enabled) {
+			continue;
+		}
+
+		Occluder *occluder = p_occluder_owner.get_or_null(instance.occluder);
+		if (!occluder) {
+			continue;
+		}
+
+		uint32_t first_vertex = vertices.size();
+		uint32_t vertex_count = occluder->vertices.size();
+		const Vector3 *read = occluder->vertices.ptr();
+		for (uint32_t i = 0; i < vertex_count; i++) {
+			vertices.push_back(instance.xform.xform(read[i]));
+		}
+
+		uint32_t index_count = occluder->indices.size() - occluder->indices.size() % 3;
+		const int32_t *read_indices = occluder->indices.ptr();
+		for (uint32_t i = 0; i < index_count; i += 3) {
+			if ((uint32_t)read_indices[i] >= vertex_count || (uint32_t)read_indices[i + 1] >= vertex_count || (uint32_t)read_indices[i + 2] >= vertex_count) {
+				continue;
+			}
+			indices.push_back(first_vertex + read_indices[i]);
+			indices.push_back(first_vertex + read_indices[i + 1]);
+			indices.push_back(first_vertex + read_indices[i + 2]);
+		}
+	}
+}
+
+////////////////////////////////////////////////////////
+
+bool RasterOcclusionCull::is_occluder(RID p_rid) {
+	return occluder_owner.owns(p_rid);
+}
+
+RID RasterOcclusionCull::occluder_allocate() {
+	return occluder_owner.allocate_rid();
+}
+
+void RasterOcclusionCull::occluder_initialize(RID p_occluder) {
+	Occluder *occluder = memnew(Occluder);
+	occluder_owner.initialize_rid(p_occluder, occluder);
+}
+
+void RasterOcclusionCull::occluder_set_mesh(RID p_occluder, const PackedVector3Array &p_vertices, const PackedInt32Array &p_indices) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+
+	occluder->vertices = p_vertices;
+	occluder->indices = p_indices;
+
+	for (const RID &E : occluder->scenarios) {
+		Scenario *scenario = scenarios.getptr(E);
+		if (scenario) {
+			scenario->dirty = true;
+		}
+	}
+}
+
+void RasterOcclusionCull::free_occluder(RID p_occluder) {
+	Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+	ERR_FAIL_NULL(occluder);
+
+	for (const RID &E : occluder->scenarios) {
+		Scenario *scenario = scenarios.getptr(E);
+		if (scenario) {
+			scenario->dirty = true;
+		}
+	}
+
+	memdelete(occluder);
+	occluder_owner.free(p_occluder);
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::add_scenario(RID p_scenario) {
+	ERR_FAIL_COND(scenarios.has(p_scenario));
+	scenarios[p_scenario] = Scenario();
+}
+
+void RasterOcclusionCull::remove_scenario(RID p_scenario) {
+	ERR_FAIL_COND(!scenarios.has(p_scenario));
+	scenarios.erase(p_scenario);
+}
+
+void RasterOcclusionCull::scenario_set_instance(RID p_scenario, RID p_instance, RID p_occluder, const Transform3D &p_xform, bool p_enabled) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+
+	if (p_occluder.is_valid()) {
+		Occluder *occluder = occluder_owner.get_or_null(p_occluder);
+		ERR_FAIL_NULL(occluder);
+		occluder->scenarios.insert(p_scenario);
+	}
+
+	OccluderInstance &instance = scenario->instances[p_instance];
+	if (instance.occluder != p_occluder || instance.xform != p_xform || instance.enabled != p_enabled) {
+		instance.occluder = p_occluder;
+		instance.xform = p_xform;
+		instance.enabled = p_enabled;
+		scenario->dirty = true;
+	}
+}
+
+void RasterOcclusionCull::scenario_remove_instance(RID p_scenario, RID p_instance) {
+	Scenario *scenario = scenarios.getptr(p_scenario);
+	ERR_FAIL_NULL(scenario);
+
+	if (scenario->instances.erase(p_instance)) {
+		scenario->dirty = true;
+	}
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::add_buffer(RID p_buffer) {
+	ERR_FAIL_COND(buffers.has(p_buffer));
+	buffers[p_buffer] = RasterHZBuffer();
+}
+
+void RasterOcclusionCull::remove_buffer(RID p_buffer) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers.erase(p_buffer);
+}
+
+void RasterOcclusionCull::buffer_set_scenario(RID p_buffer, RID p_scenario) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	ERR_FAIL_COND(p_scenario.is_valid() && !scenarios.has(p_scenario));
+	buffers[p_buffer].scenario_rid = p_scenario;
+}
+
+void RasterOcclusionCull::buffer_set_size(RID p_buffer, const Vector2i &p_size) {
+	ERR_FAIL_COND(!buffers.has(p_buffer));
+	buffers[p_buffer].resize(p_size);
+}
+
+void RasterOcclusionCull::buffer_update(RID p_buffer, const Transform3D &p_cam_transform, const Projection &p_cam_projection, bool p_cam_orthogonal) {
+	RasterHZBuffer *buffer = buffers.getptr(p_buffer);
+	if (!buffer || buffer->is_empty()) {
+		return;
+	}
+
+	Scenario *scenario = scenarios.getptr(buffer->scenario_rid);
+	if (!scenario) {
+		return;
+	}
+
+	scenario->update(occluder_owner);
+
+	buffer->rasterize(scenario->vertices.ptr(), scenario->vertices.size(), scenario->indices.ptr(), scenario->indices.size(), p_cam_transform, p_cam_projection, p_cam_orthogonal);
+}
+
+RasterOcclusionCull::HZBuffer *RasterOcclusionCull::buffer_get_ptr(RID p_buffer) {
+	return buffers.getptr(p_buffer);
+}
+
+RID RasterOcclusionCull::buffer_get_debug_texture(RID p_buffer) {
+	ERR_FAIL_COND_V(!buffers.has(p_buffer), RID());
+	return buffers[p_buffer].get_debug_texture();
+}
+
+////////////////////////////////////////////////////////
+
+void RasterOcclusionCull::set_build_quality(RS::ViewportOcclusionCullingBuildQuality p_quality) {
+	// Occluders are rasterized directly, there is no acceleration structure to build.
+}
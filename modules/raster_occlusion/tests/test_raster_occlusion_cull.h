@@ -0,0 +1,282 @@
+/**************************************************************************/
+/*  test_raster_occlusion_cull.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_RASTER_OCCLUSION_CULL_H
+#define TEST_RASTER_OCCLUSION_CULL_H
+
+#include "../raster_occlusion_cull.h"
+
+#include "core/math/random_number_generator.h"
+#include "core/os/os.h"
+
+#include "modules/modules_enabled.gen.h" // For raycast.
+
+#ifdef MODULE_RAYCAST_ENABLED
+#include "modules/raycast/raycast_occlusion_cull.h"
+
+// Created by the raycast module. The RenderingServer used by the tests doesn't use it.
+extern RaycastOcclusionCull *raycast_occlusion_cull;
+#endif // MODULE_RAYCAST_ENABLED
+
+#include "tests/test_macros.h"
+
+namespace TestRasterOcclusionCull {
+
+bool is_box_occluded(const RendererSceneOcclusionCull::HZBuffer &p_buffer, const AABB &p_aabb, const Transform3D &p_cam_transform, const Projection &p_cam_projection) {
+	real_t bounds[6] = {
+		p_aabb.position.x, p_aabb.position.y, p_aabb.position.z,
+		p_aabb.position.x + p_aabb.size.x, p_aabb.position.y + p_aabb.size.y, p_aabb.position.z + p_aabb.size.z
+	};
+	return p_buffer.is_occluded(bounds, p_cam_transform.origin, p_cam_transform.affine_inverse(), p_cam_projection, p_cam_projection.get_z_near());
+}
+
+TEST_CASE("[RasterOcclusionCull] Boxes behind an occluder are culled") {
+	// A 10x10 wall, 10 units in front of the camera.
+	const Vector3 vertices[4] = {
+		Vector3(-5, -5, -10),
+		Vector3(5, -5, -10),
+		Vector3(5, 5, -10),
+		Vector3(-5, 5, -10),
+	};
+	const uint32_t indices[6] = { 0, 1, 2, 0, 2, 3 };
+
+	Transform3D cam_transform;
+	Projection cam_projection;
+	cam_projection.set_perspective(70, 1.0, 0.05, 100);
+
+	RasterOcclusionCull::RasterHZBuffer buffer;
+	buffer.resize(Size2i(64, 64));
+	buffer.rasterize(vertices, 4, indices, 6, cam_transform, cam_projection, false);
+
+	CHECK_MESSAGE(is_box_occluded(buffer, AABB(Vector3(-1, -1, -21), Vector3(2, 2, 2)), cam_transform, cam_projection), "A box right behind the wall should be occluded.");
+	CHECK_MESSAGE(!is_box_occluded(buffer, AABB(Vector3(-1, -1, -6), Vector3(2, 2, 2)), cam_transform, cam_projection), "A box in front of the wall should not be occluded.");
+	CHECK_MESSAGE(!is_box_occluded(buffer, AABB(Vector3(9, -1, -21), Vector3(2, 2, 2)), cam_transform, cam_projection), "A box behind the wall but visible past its edge should not be occluded.");
+	CHECK_MESSAGE(!is_box_occluded(buffer, AABB(Vector3(-15, -15, -21), Vector3(30, 30, 2)), cam_transform, cam_projection), "A box larger than the wall should not be occluded.");
+
+	// Seen from behind, the wall is past the camera and must not occlude anything.
+	Transform3D turned_transform = Transform3D(Basis(Vector3(0, 1, 0), Math_PI), Vector3());
+	buffer.rasterize(vertices, 4, indices, 6, turned_transform, cam_projection, false);
+	CHECK_MESSAGE(!is_box_occluded(buffer, AABB(Vector3(-1, -1, 19), Vector3(2, 2, 2)), turned_transform, cam_projection), "Occluders behind the camera should not occlude anything.");
+}
+
+TEST_CASE("[RasterOcclusionCull] Occluders crossing the near plane are clipped") {
+	// A floor extending from behind the camera to far in front of it, with a
+	// wall standing on it. Only the wall should occlude.
+	const Vector3 vertices[8] = {
+		Vector3(-50, -1, 10),
+		Vector3(50, -1, 10),
+		Vector3(50, -1, -90),
+		Vector3(-50, -1, -90),
+		Vector3(-50, -1, -20),
+		Vector3(50, -1, -20),
+		Vector3(50, 50, -20),
+		Vector3(-50, 50, -20),
+	};
+	const uint32_t indices[12] = { 0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7 };
+
+	Transform3D cam_transform;
+	Projection cam_projection;
+	cam_projection.set_perspective(70, 1.0, 0.05, 100);
+
+	RasterOcclusionCull::RasterHZBuffer buffer;
+	buffer.resize(Size2i(64, 64));
+	buffer.rasterize(vertices, 8, indices, 12, cam_transform, cam_projection, false);
+
+	CHECK_MESSAGE(is_box_occluded(buffer, AABB(Vector3(-1, 0, -31), Vector3(2, 2, 2)), cam_transform, cam_projection), "A box behind the wall should be occluded.");
+	CHECK_MESSAGE(!is_box_occluded(buffer, AABB(Vector3(-1, 0, -11), Vector3(2, 2, 2)), cam_transform, cam_projection), "A box standing on the floor in front of the wall should not be occluded.");
+}
+
+#ifdef MODULE_RAYCAST_ENABLED
+TEST_CASE("[SceneTree][RasterOcclusionCull] Occlusion matches the raycast backend") {
+	REQUIRE(raycast_occlusion_cull != nullptr);
+
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(11);
+
+	// Walls scattered in front of the camera, in a single occluder.
+	PackedVector3Array vertices;
+	PackedInt32Array indices;
+	for (int i = 0; i < 40; i++) {
+		Vector3 center(rng->randf_range(-30, 30), rng->randf_range(-5, 5), rng->randf_range(-60, -10));
+		Vector3 side = Vector3(1, 0, 0).rotated(Vector3(0, 1, 0), rng->randf_range(-0.5, 0.5)) * rng->randf_range(2, 8);
+		Vector3 up(0, rng->randf_range(2, 8), 0);
+		int base = vertices.size();
+		vertices.push_back(center - side - up);
+		vertices.push_back(center + side - up);
+		vertices.push_back(center + side + up);
+		vertices.push_back(center - side + up);
+		const int quad[6] = { 0, 1, 2, 0, 2, 3 };
+		for (int j = 0; j < 6; j++) {
+			indices.push_back(base + quad[j]);
+		}
+	}
+	// A wall right in front of the camera, used to tell when the raycast backend is ready.
+	const Vector3 front_wall[4] = { Vector3(-2, -2, -5), Vector3(2, -2, -5), Vector3(2, 2, -5), Vector3(-2, 2, -5) };
+	int base = vertices.size();
+	for (int j = 0; j < 4; j++) {
+		vertices.push_back(front_wall[j]);
+	}
+	const int quad[6] = { 0, 1, 2, 0, 2, 3 };
+	for (int j = 0; j < 6; j++) {
+		indices.push_back(base + quad[j]);
+	}
+
+	Transform3D cam_transform;
+	Projection cam_projection;
+	cam_projection.set_perspective(70, 1.0, 0.05, 100);
+	const Size2i size = Size2i(128, 128);
+
+	RasterOcclusionCull::RasterHZBuffer raster_buffer;
+	raster_buffer.resize(size);
+	LocalVector<uint32_t> raster_indices;
+	for (int index : indices) {
+		raster_indices.push_back(index);
+	}
+	raster_buffer.rasterize(vertices.ptr(), vertices.size(), raster_indices.ptr(), raster_indices.size(), cam_transform, cam_projection, false);
+
+	RenderingServer *rs = RS::get_singleton();
+	RID scenario = rs->scenario_create();
+	RID instance = rs->instance_create();
+	RID buffer = rs->viewport_create(); // Occlusion buffers belong to viewports.
+	RID occluder = raycast_occlusion_cull->occluder_allocate();
+	raycast_occlusion_cull->occluder_initialize(occluder);
+	raycast_occlusion_cull->occluder_set_mesh(occluder, vertices, indices);
+	raycast_occlusion_cull->add_scenario(scenario);
+	raycast_occlusion_cull->scenario_set_instance(scenario, instance, occluder, Transform3D(), true);
+	raycast_occlusion_cull->add_buffer(buffer);
+	raycast_occlusion_cull->buffer_set_scenario(buffer, scenario);
+	raycast_occlusion_cull->buffer_set_size(buffer, size);
+	const RendererSceneOcclusionCull::HZBuffer *raycast_buffer = raycast_occlusion_cull->buffer_get_ptr(buffer);
+
+	// The raycast backend builds its scene on a thread, and only uses it once it's done.
+	const AABB behind_front_wall = AABB(Vector3(-0.5, -0.5, -8), Vector3(1, 1, 1));
+	bool ready = false;
+	for (int i = 0; i < 500 && !ready; i++) {
+		raycast_occlusion_cull->buffer_update(buffer, cam_transform, cam_projection, false);
+		ready = is_box_occluded(*raycast_buffer, behind_front_wall, cam_transform, cam_projection);
+		if (!ready) {
+			OS::get_singleton()->delay_usec(10000);
+		}
+	}
+	REQUIRE_MESSAGE(ready, "The raycast backend should finish building its scene.");
+	CHECK(is_box_occluded(raster_buffer, behind_front_wall, cam_transform, cam_projection));
+
+	// Both backends sample occluders at pixel centers, but store and reduce depth differently,
+	// so boxes that barely peek past an edge may be classified differently.
+	const int box_count = 2000;
+	int occluded_count = 0;
+	int mismatch_count = 0;
+	for (int i = 0; i < box_count; i++) {
+		const real_t depth = rng->randf_range(5, 80);
+		const AABB box = AABB(Vector3(rng->randf_range(-0.6, 0.6) * depth, rng->randf_range(-0.6, 0.6) * depth, -depth), Vector3(1, 1, 1));
+		const bool raycast_occluded = is_box_occluded(*raycast_buffer, box, cam_transform, cam_projection);
+		const bool raster_occluded = is_box_occluded(raster_buffer, box, cam_transform, cam_projection);
+		occluded_count += raycast_occluded;
+		mismatch_count += raycast_occluded != raster_occluded;
+	}
+
+	CHECK_MESSAGE(occluded_count > box_count / 20, "Enough boxes should be occluded for the comparison to be meaningful.");
+	CHECK_MESSAGE(mismatch_count <= box_count / 25, vformat("%d of %d boxes were classified differently by the two backends.", mismatch_count, box_count));
+
+	raycast_occlusion_cull->remove_buffer(buffer);
+	raycast_occlusion_cull->scenario_remove_instance(scenario, instance);
+	raycast_occlusion_cull->remove_scenario(scenario);
+	raycast_occlusion_cull->free_occluder(occluder);
+	rs->free(buffer);
+	rs->free(instance);
+	rs->free(scenario);
+}
+#endif // MODULE_RAYCAST_ENABLED
+
+TEST_CASE("[RasterOcclusionCull][Benchmark] Rasterization and occlusion queries" * doctest::skip()) {
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(7);
+
+	// Walls scattered in front of the camera, similar to building occluders in a city block.
+	const uint32_t wall_count = 2000;
+	LocalVector<Vector3> vertices;
+	LocalVector<uint32_t> indices;
+	for (uint32_t i = 0; i < wall_count; i++) {
+		Vector3 center(rng->randf_range(-100, 100), rng->randf_range(-10, 10), rng->randf_range(-150, -5));
+		Vector3 side = Vector3(1, 0, 0).rotated(Vector3(0, 1, 0), rng->randf_range(0, Math_PI)) * rng->randf_range(1, 10);
+		Vector3 up(0, rng->randf_range(1, 10), 0);
+		uint32_t base = vertices.size();
+		vertices.push_back(center - side - up);
+		vertices.push_back(center + side - up);
+		vertices.push_back(center + side + up);
+		vertices.push_back(center - side + up);
+		const uint32_t quad[6] = { 0, 1, 2, 0, 2, 3 };
+		for (uint32_t j = 0; j < 6; j++) {
+			indices.push_back(base + quad[j]);
+		}
+	}
+
+	Transform3D cam_transform;
+	Projection cam_projection;
+	cam_projection.set_perspective(70, 16.0 / 9.0, 0.05, 200);
+
+	RasterOcclusionCull::RasterHZBuffer buffer;
+	buffer.resize(Size2i(512, 288));
+
+	const int rounds = 100;
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < rounds; i++) {
+		buffer.rasterize(vertices.ptr(), vertices.size(), indices.ptr(), indices.size(), cam_transform, cam_projection, false);
+	}
+	const uint64_t rasterize_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	const uint32_t box_count = 100000;
+	LocalVector<AABB> boxes;
+	for (uint32_t i = 0; i < box_count; i++) {
+		boxes.push_back(AABB(Vector3(rng->randf_range(-100, 100), rng->randf_range(-10, 10), rng->randf_range(-190, -5)), Vector3(1, 1, 1)));
+	}
+
+	const Transform3D cam_inverse = cam_transform.affine_inverse();
+	uint32_t occluded_count = 0;
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (const AABB &box : boxes) {
+		real_t bounds[6] = {
+			box.position.x, box.position.y, box.position.z,
+			box.position.x + box.size.x, box.position.y + box.size.y, box.position.z + box.size.z
+		};
+		occluded_count += buffer.is_occluded(bounds, cam_transform.origin, cam_inverse, cam_projection, cam_projection.get_z_near());
+	}
+	const uint64_t query_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE("Rasterizing ", wall_count * 2, " triangles at 512x288: ", rasterize_usec / 1000.0 / rounds, " ms.");
+	MESSAGE("Occlusion queries: ", query_usec * 1000.0 / box_count, " ns per box, ", occluded_count, " of ", box_count, " occluded.");
+	CHECK(occluded_count > 0);
+}
+
+} // namespace TestRasterOcclusionCull
+
+#endif // TEST_RASTER_OCCLUSION_CULL_H
@@ -45,27 +45,44 @@ void LightmapRaycasterEmbree::make_default_raycaster() {
 }
 
 void LightmapRaycasterEmbree::filter_function(const struct RTCFilterFunctionNArguments *p_args) {
-	RTCHit *hit = (RTCHit *)p_args->hit;
+	// Packets and streams invoke the filter with N > 1 hits in SoA layout.
+	LightmapRaycasterEmbree *scene = (LightmapRaycasterEmbree *)p_args->geometryUserPtr;
+	RTCHitN *hit = p_args->hit;
+	const unsigned int n = p_args->N;
 
-	unsigned int geomID = hit->geomID;
-	float u = hit->u;
-	float v = hit->v;
+	for (unsigned int i = 0; i < n; i++) {
+		if (p_args->valid[i] == 0) {
+			continue;
+		}
 
-	LightmapRaycasterEmbree *scene = (LightmapRaycasterEmbree *)p_args->geometryUserPtr;
-	RTCGeometry geom = rtcGetGeometry(scene->embree_scene, geomID);
+		unsigned int geomID = RTCHitN_geomID(hit, n, i);
+		unsigned int primID = RTCHitN_primID(hit, n, i);
+		float u = RTCHitN_u(hit, n, i);
+		float v = RTCHitN_v(hit, n, i);
 
-	rtcInterpolate0(geom, hit->primID, hit->u, hit->v, RTC_BUFFER_TYPE_VERTEX_ATTRIBUTE, 0, &hit->u, 2);
+		RTCGeometry geom = rtcGetGeometry(scene->embree_scene, geomID);
 
-	if (scene->alpha_textures.has(geomID)) {
-		const AlphaTextureData &alpha_texture = scene->alpha_textures[geomID];
+		float uv2[2];
+		rtcInterpolate0(geom, primID, u, v, RTC_BUFFER_TYPE_VERTEX_ATTRIBUTE, 0, uv2, 2);
 
-		if (alpha_texture.sample(hit->u, hit->v) < 128) {
-			p_args->valid[0] = 0;
-			return;
+		if (scene->alpha_textures.has(geomID)) {
+			const AlphaTextureData &alpha_texture = scene->alpha_textures[geomID];
+
+			if (alpha_texture.sample(uv2[0], uv2[1]) < 128) {
+				p_args->valid[i] = 0;
+				continue;
+			}
 		}
-	}
 
-	rtcInterpolate0(geom, hit->primID, u, v, RTC_BUFFER_TYPE_VERTEX_ATTRIBUTE, 1, &hit->Ng_x, 3);
+		float normal[3];
+		rtcInterpolate0(geom, primID, u, v, RTC_BUFFER_TYPE_VERTEX_ATTRIBUTE, 1, normal, 3);
+
+		RTCHitN_u(hit, n, i) = uv2[0];
+		RTCHitN_v(hit, n, i) = uv2[1];
+		RTCHitN_Ng_x(hit, n, i) = normal[0];
+		RTCHitN_Ng_y(hit, n, i) = normal[1];
+		RTCHitN_Ng_z(hit, n, i) = normal[2];
+	}
 }
 
 bool LightmapRaycasterEmbree::intersect(Ray &r_ray) {
@@ -78,10 +95,17 @@ bool LightmapRaycasterEmbree::intersect(Ray &r_ray) {
 }
 
 void LightmapRaycasterEmbree::intersect(Vector<Ray> &r_rays) {
-	Ray *rays = r_rays.ptrw();
-	for (int i = 0; i < r_rays.size(); ++i) {
-		intersect(rays[i]);
+	if (r_rays.is_empty()) {
+		return;
 	}
+
+	// Batches are usually built from neighboring texels, so let Embree trace them as SIMD packets.
+	RTCIntersectContext context;
+
+	rtcInitIntersectContext(&context);
+	context.flags = RTC_INTERSECT_CONTEXT_FLAG_COHERENT;
+
+	rtcIntersect1M(embree_scene, &context, (RTCRayHit *)r_rays.ptrw(), r_rays.size(), sizeof(Ray));
 }
 
 void LightmapRaycasterEmbree::set_mesh_alpha_texture(Ref<Image> p_alpha_texture, unsigned int p_id) {
@@ -1815,6 +1815,8 @@ _FORCE_INLINE_ void TextServerAdvanced::_font_clear_cache(FontAdvanced *p_font_d
 	p_font_data->supported_features.clear();
 	p_font_data->supported_varaitions.clear();
 	p_font_data->supported_scripts.clear();
+
+	_shaping_cache_clear();
 }
 
 hb_font_t *TextServerAdvanced::_font_get_hb_handle(const RID &p_font_rid, int64_t p_size) const {
@@ -2262,6 +2264,7 @@ void TextServerAdvanced::_font_set_fixed_size(const RID &p_font_rid, int64_t p_f
 
 	MutexLock lock(fd->mutex);
 	fd->fixed_size = p_fixed_size;
+	_shaping_cache_clear();
 }
 
 int64_t TextServerAdvanced::_font_get_fixed_size(const RID &p_font_rid) const {
@@ -2278,6 +2281,7 @@ void TextServerAdvanced::_font_set_fixed_size_scale_mode(const RID &p_font_rid,
 
 	MutexLock lock(fd->mutex);
 	fd->fixed_size_scale_mode = p_fixed_size_scale_mode;
+	_shaping_cache_clear();
 }
 
 TextServer::FixedSizeScaleMode TextServerAdvanced::_font_get_fixed_size_scale_mode(const RID &p_font_rid) const {
@@ -2294,6 +2298,7 @@ void TextServerAdvanced::_font_set_allow_system_fallback(const RID &p_font_rid,
 
 	MutexLock lock(fd->mutex);
 	fd->allow_system_fallback = p_allow_system_fallback;
+	_shaping_cache_clear();
 }
 
 bool TextServerAdvanced::_font_is_allow_system_fallback(const RID &p_font_rid) const {
@@ -2348,6 +2353,7 @@ void TextServerAdvanced::_font_set_subpixel_positioning(const RID &p_font_rid, T
 
 	MutexLock lock(fd->mutex);
 	fd->subpixel_positioning = p_subpixel;
+	_shaping_cache_clear();
 }
 
 TextServer::SubpixelPositioning TextServerAdvanced::_font_get_subpixel_positioning(const RID &p_font_rid) const {
@@ -2383,6 +2389,7 @@ void TextServerAdvanced::_font_set_spacing(const RID &p_font_rid, SpacingType p_
 	if (fdv) {
 		if (fdv->extra_spacing[p_spacing] != p_value) {
 			fdv->extra_spacing[p_spacing] = p_value;
+			_shaping_cache_clear();
 		}
 	} else {
 		FontAdvanced *fd = font_owner.get_or_null(p_font_rid);
@@ -2391,6 +2398,7 @@ void TextServerAdvanced::_font_set_spacing(const RID &p_font_rid, SpacingType p_
 		MutexLock lock(fd->mutex);
 		if (fd->extra_spacing[p_spacing] != p_value) {
 			fd->extra_spacing[p_spacing] = p_value;
+			_shaping_cache_clear();
 		}
 	}
 }
@@ -2488,6 +2496,7 @@ void TextServerAdvanced::_font_clear_size_cache(const RID &p_font_rid) {
 		memdelete(E.value);
 	}
 	fd->cache.clear();
+	_shaping_cache_clear();
 }
 
 void TextServerAdvanced::_font_remove_size_cache(const RID &p_font_rid, const Vector2i &p_size) {
@@ -2500,6 +2509,7 @@ void TextServerAdvanced::_font_remove_size_cache(const RID &p_font_rid, const Ve
 		memdelete(fd->cache[p_size]);
 		fd->cache.erase(p_size);
 	}
+	_shaping_cache_clear();
 }
 
 void TextServerAdvanced::_font_set_ascent(const RID &p_font_rid, int64_t p_size, double p_ascent) {
@@ -2511,6 +2521,7 @@ void TextServerAdvanced::_font_set_ascent(const RID &p_font_rid, int64_t p_size,
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
 	fd->cache[size]->ascent = p_ascent;
+	_shaping_cache_clear();
 }
 
 double TextServerAdvanced::_font_get_ascent(const RID &p_font_rid, int64_t p_size) const {
@@ -2543,6 +2554,7 @@ void TextServerAdvanced::_font_set_descent(const RID &p_font_rid, int64_t p_size
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
 	fd->cache[size]->descent = p_descent;
+	_shaping_cache_clear();
 }
 
 double TextServerAdvanced::_font_get_descent(const RID &p_font_rid, int64_t p_size) const {
@@ -2576,6 +2588,7 @@ void TextServerAdvanced::_font_set_underline_position(const RID &p_font_rid, int
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
 	fd->cache[size]->underline_position = p_underline_position;
+	_shaping_cache_clear();
 }
 
 double TextServerAdvanced::_font_get_underline_position(const RID &p_font_rid, int64_t p_size) const {
@@ -2609,6 +2622,7 @@ void TextServerAdvanced::_font_set_underline_thickness(const RID &p_font_rid, in
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
 	fd->cache[size]->underline_thickness = p_underline_thickness;
+	_shaping_cache_clear();
 }
 
 double TextServerAdvanced::_font_get_underline_thickness(const RID &p_font_rid, int64_t p_size) const {
@@ -2647,6 +2661,7 @@ void TextServerAdvanced::_font_set_scale(const RID &p_font_rid, int64_t p_size,
 	}
 #endif
 	fd->cache[size]->scale = p_scale;
+	_shaping_cache_clear();
 }
 
 double TextServerAdvanced::_font_get_scale(const RID &p_font_rid, int64_t p_size) const {
@@ -2817,6 +2832,7 @@ void TextServerAdvanced::_font_clear_glyphs(const RID &p_font_rid, const Vector2
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
 
 	fd->cache[size]->glyph_map.clear();
+	_shaping_cache_clear();
 }
 
 void TextServerAdvanced::_font_remove_glyph(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) {
@@ -2828,6 +2844,7 @@ void TextServerAdvanced::_font_remove_glyph(const RID &p_font_rid, const Vector2
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
 
 	fd->cache[size]->glyph_map.erase(p_glyph);
+	_shaping_cache_clear();
 }
 
 double TextServerAdvanced::_get_extra_advance(RID p_font_rid, int p_font_size) const {
@@ -2901,6 +2918,7 @@ void TextServerAdvanced::_font_set_glyph_advance(const RID &p_font_rid, int64_t
 
 	gl[p_glyph].advance = p_advance;
 	gl[p_glyph].found = true;
+	_shaping_cache_clear();
 }
 
 Vector2 TextServerAdvanced::_font_get_glyph_offset(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) const {
@@ -2952,6 +2970,7 @@ void TextServerAdvanced::_font_set_glyph_offset(const RID &p_font_rid, const Vec
 
 	gl[p_glyph].rect.position = p_offset;
 	gl[p_glyph].found = true;
+	_shaping_cache_clear();
 }
 
 Vector2 TextServerAdvanced::_font_get_glyph_size(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) const {
@@ -3003,6 +3022,7 @@ void TextServerAdvanced::_font_set_glyph_size(const RID &p_font_rid, const Vecto
 
 	gl[p_glyph].rect.size = p_gl_size;
 	gl[p_glyph].found = true;
+	_shaping_cache_clear();
 }
 
 Rect2 TextServerAdvanced::_font_get_glyph_uv_rect(const RID &p_font_rid, const Vector2i &p_size, int64_t p_glyph) const {
@@ -3258,6 +3278,7 @@ void TextServerAdvanced::_font_clear_kerning_map(const RID &p_font_rid, int64_t
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
 	fd->cache[size]->kerning_map.clear();
+	_shaping_cache_clear();
 }
 
 void TextServerAdvanced::_font_remove_kerning(const RID &p_font_rid, int64_t p_size, const Vector2i &p_glyph_pair) {
@@ -3269,6 +3290,7 @@ void TextServerAdvanced::_font_remove_kerning(const RID &p_font_rid, int64_t p_s
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
 	fd->cache[size]->kerning_map.erase(p_glyph_pair);
+	_shaping_cache_clear();
 }
 
 void TextServerAdvanced::_font_set_kerning(const RID &p_font_rid, int64_t p_size, const Vector2i &p_glyph_pair, const Vector2 &p_kerning) {
@@ -3280,6 +3302,7 @@ void TextServerAdvanced::_font_set_kerning(const RID &p_font_rid, int64_t p_size
 
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
 	fd->cache[size]->kerning_map[p_glyph_pair] = p_kerning;
+	_shaping_cache_clear();
 }
 
 Vector2 TextServerAdvanced::_font_get_kerning(const RID &p_font_rid, int64_t p_size, const Vector2i &p_glyph_pair) const {
@@ -3729,6 +3752,7 @@ void TextServerAdvanced::_font_set_language_support_override(const RID &p_font_r
 
 	MutexLock lock(fd->mutex);
 	fd->language_support_overrides[p_language] = p_supported;
+	_shaping_cache_clear();
 }
 
 bool TextServerAdvanced::_font_get_language_support_override(const RID &p_font_rid, const String &p_language) {
@@ -3745,6 +3769,7 @@ void TextServerAdvanced::_font_remove_language_support_override(const RID &p_fon
 
 	MutexLock lock(fd->mutex);
 	fd->language_support_overrides.erase(p_language);
+	_shaping_cache_clear();
 }
 
 PackedStringArray TextServerAdvanced::_font_get_language_support_overrides(const RID &p_font_rid) {
@@ -3779,6 +3804,7 @@ void TextServerAdvanced::_font_set_script_support_override(const RID &p_font_rid
 
 	MutexLock lock(fd->mutex);
 	fd->script_support_overrides[p_script] = p_supported;
+	_shaping_cache_clear();
 }
 
 bool TextServerAdvanced::_font_get_script_support_override(const RID &p_font_rid, const String &p_script) {
@@ -3795,6 +3821,7 @@ void TextServerAdvanced::_font_remove_script_support_override(const RID &p_font_
 
 	MutexLock lock(fd->mutex);
 	fd->script_support_overrides.erase(p_script);
+	_shaping_cache_clear();
 }
 
 PackedStringArray TextServerAdvanced::_font_get_script_support_overrides(const RID &p_font_rid) {
@@ -3817,6 +3844,7 @@ void TextServerAdvanced::_font_set_opentype_feature_overrides(const RID &p_font_
 	Vector2i size = _get_size(fd, 16);
 	ERR_FAIL_COND(!_ensure_cache_for_size(fd, size));
 	fd->feature_overrides = p_overrides;
+	_shaping_cache_clear();
 }
 
 Dictionary TextServerAdvanced::_font_get_opentype_feature_overrides(const RID &p_font_rid) const {
@@ -5571,6 +5599,7 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 		// Try system fallback.
 		RID fdef = p_fonts[0];
 		if (_font_is_allow_system_fallback(fdef)) {
+			_THREAD_SAFE_METHOD_ // System font cache is shared by paragraphs shaped in parallel.
 			_update_chars(p_sd);
 
 			int64_t next = p_end;
@@ -5777,158 +5806,167 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 
 	FontAdvanced *fd = _get_font_data(f);
 	ERR_FAIL_NULL(fd);
-	MutexLock lock(fd->mutex);
 
-	Vector2i fss = _get_size(fd, fs);
-	hb_font_t *hb_font = _font_get_hb_handle(f, fs);
-	double scale = _font_get_scale(f, fs);
-	double sp_sp = p_sd->extra_spacing[SPACING_SPACE] + _font_get_spacing(f, SPACING_SPACE);
-	double sp_gl = p_sd->extra_spacing[SPACING_GLYPH] + _font_get_spacing(f, SPACING_GLYPH);
-	bool last_run = (p_sd->end == p_end);
-	double ea = _get_extra_advance(f, fs);
-	bool subpos = (scale != 1.0) || (_font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_ONE_HALF) || (_font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_ONE_QUARTER) || (_font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_AUTO && fs <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE);
-	ERR_FAIL_NULL(hb_font);
+	// The font is only locked while shaping with it. Fallback runs are shaped after it is released, so
+	// paragraphs shaped in parallel never wait for another font (or for the system fallback lookup)
+	// while holding one, which could deadlock with a paragraph that uses them in the other order.
+	Glyph *w = nullptr;
+	unsigned int glyph_count = 0;
+	{
+		MutexLock lock(fd->mutex);
 
-	hb_buffer_clear_contents(p_sd->hb_buffer);
-	hb_buffer_set_direction(p_sd->hb_buffer, p_direction);
-	int flags = (p_start == 0 ? HB_BUFFER_FLAG_BOT : 0) | (p_end == p_sd->text.length() ? HB_BUFFER_FLAG_EOT : 0);
-	if (p_sd->preserve_control) {
-		flags |= HB_BUFFER_FLAG_PRESERVE_DEFAULT_IGNORABLES;
-	} else {
-		flags |= HB_BUFFER_FLAG_DEFAULT;
-	}
-#if HB_VERSION_ATLEAST(5, 1, 0)
-	flags |= HB_BUFFER_FLAG_PRODUCE_SAFE_TO_INSERT_TATWEEL;
-#endif
-	hb_buffer_set_flags(p_sd->hb_buffer, (hb_buffer_flags_t)flags);
-	hb_buffer_set_script(p_sd->hb_buffer, p_script);
+		Vector2i fss = _get_size(fd, fs);
+		hb_font_t *hb_font = _font_get_hb_handle(f, fs);
+		double scale = _font_get_scale(f, fs);
+		double sp_sp = p_sd->extra_spacing[SPACING_SPACE] + _font_get_spacing(f, SPACING_SPACE);
+		double sp_gl = p_sd->extra_spacing[SPACING_GLYPH] + _font_get_spacing(f, SPACING_GLYPH);
+		bool last_run = (p_sd->end == p_end);
+		double ea = _get_extra_advance(f, fs);
+		bool subpos = (scale != 1.0) || (_font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_ONE_HALF) || (_font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_ONE_QUARTER) || (_font_get_subpixel_positioning(f) == SUBPIXEL_POSITIONING_AUTO && fs <= SUBPIXEL_POSITIONING_ONE_HALF_MAX_SIZE);
+		ERR_FAIL_NULL(hb_font);
+
+		hb_buffer_clear_contents(p_sd->hb_buffer);
+		hb_buffer_set_direction(p_sd->hb_buffer, p_direction);
+		int flags = (p_start == 0 ? HB_BUFFER_FLAG_BOT : 0) | (p_end == p_sd->text.length() ? HB_BUFFER_FLAG_EOT : 0);
+		if (p_sd->preserve_control) {
+			flags |= HB_BUFFER_FLAG_PRESERVE_DEFAULT_IGNORABLES;
+		} else {
+			flags |= HB_BUFFER_FLAG_DEFAULT;
+		}
+	#if HB_VERSION_ATLEAST(5, 1, 0)
+		flags |= HB_BUFFER_FLAG_PRODUCE_SAFE_TO_INSERT_TATWEEL;
+	#endif
+		hb_buffer_set_flags(p_sd->hb_buffer, (hb_buffer_flags_t)flags);
+		hb_buffer_set_script(p_sd->hb_buffer, p_script);
 
-	if (p_sd->spans[p_span].language.is_empty()) {
-		hb_language_t lang = hb_language_from_string(TranslationServer::get_singleton()->get_tool_locale().ascii().get_data(), -1);
-		hb_buffer_set_language(p_sd->hb_buffer, lang);
-	} else {
-		hb_language_t lang = hb_language_from_string(p_sd->spans[p_span].language.ascii().get_data(), -1);
-		hb_buffer_set_language(p_sd->hb_buffer, lang);
-	}
+		if (p_sd->spans[p_span].language.is_empty()) {
+			hb_language_t lang = hb_language_from_string(TranslationServer::get_singleton()->get_tool_locale().ascii().get_data(), -1);
+			hb_buffer_set_language(p_sd->hb_buffer, lang);
+		} else {
+			hb_language_t lang = hb_language_from_string(p_sd->spans[p_span].language.ascii().get_data(), -1);
+			hb_buffer_set_language(p_sd->hb_buffer, lang);
+		}
 
-	hb_buffer_add_utf32(p_sd->hb_buffer, (const uint32_t *)p_sd->text.ptr(), p_sd->text.length(), p_start, p_end - p_start);
+		hb_buffer_add_utf32(p_sd->hb_buffer, (const uint32_t *)p_sd->text.ptr(), p_sd->text.length(), p_start, p_end - p_start);
 
-	Vector<hb_feature_t> ftrs;
-	_add_featuers(_font_get_opentype_feature_overrides(f), ftrs);
-	_add_featuers(p_sd->spans[p_span].features, ftrs);
+		Vector<hb_feature_t> ftrs;
+		_add_featuers(_font_get_opentype_feature_overrides(f), ftrs);
+		_add_featuers(p_sd->spans[p_span].features, ftrs);
 
-	hb_shape(hb_font, p_sd->hb_buffer, ftrs.is_empty() ? nullptr : &ftrs[0], ftrs.size());
+		hb_shape(hb_font, p_sd->hb_buffer, ftrs.is_empty() ? nullptr : &ftrs[0], ftrs.size());
 
-	unsigned int glyph_count = 0;
-	hb_glyph_info_t *glyph_info = hb_buffer_get_glyph_infos(p_sd->hb_buffer, &glyph_count);
-	hb_glyph_position_t *glyph_pos = hb_buffer_get_glyph_positions(p_sd->hb_buffer, &glyph_count);
+		hb_glyph_info_t *glyph_info = hb_buffer_get_glyph_infos(p_sd->hb_buffer, &glyph_count);
+		hb_glyph_position_t *glyph_pos = hb_buffer_get_glyph_positions(p_sd->hb_buffer, &glyph_count);
 
-	int mod = 0;
-	if (fd->antialiasing == FONT_ANTIALIASING_LCD) {
-		TextServer::FontLCDSubpixelLayout layout = (TextServer::FontLCDSubpixelLayout)(int)GLOBAL_GET("gui/theme/lcd_subpixel_layout");
-		if (layout != FONT_LCD_SUBPIXEL_LAYOUT_NONE) {
-			mod = (layout << 24);
+		int mod = 0;
+		if (fd->antialiasing == FONT_ANTIALIASING_LCD) {
+			TextServer::FontLCDSubpixelLayout layout = (TextServer::FontLCDSubpixelLayout)(int)GLOBAL_GET("gui/theme/lcd_subpixel_layout");
+			if (layout != FONT_LCD_SUBPIXEL_LAYOUT_NONE) {
+				mod = (layout << 24);
+			}
 		}
-	}
 
-	// Process glyphs.
-	if (glyph_count > 0) {
-		Glyph *w = (Glyph *)memalloc(glyph_count * sizeof(Glyph));
+		// Process glyphs.
+		if (glyph_count > 0) {
+			w = (Glyph *)memalloc(glyph_count * sizeof(Glyph));
 
-		int end = (p_direction == HB_DIRECTION_RTL || p_direction == HB_DIRECTION_BTT) ? p_end : 0;
-		uint32_t last_cluster_id = UINT32_MAX;
-		unsigned int last_cluster_index = 0;
-		bool last_cluster_valid = true;
+			int end = (p_direction == HB_DIRECTION_RTL || p_direction == HB_DIRECTION_BTT) ? p_end : 0;
+			uint32_t last_cluster_id = UINT32_MAX;
+			unsigned int last_cluster_index = 0;
+			bool last_cluster_valid = true;
 
-		for (unsigned int i = 0; i < glyph_count; i++) {
-			if ((i > 0) && (last_cluster_id != glyph_info[i].cluster)) {
-				if (p_direction == HB_DIRECTION_RTL || p_direction == HB_DIRECTION_BTT) {
-					end = w[last_cluster_index].start;
-				} else {
-					for (unsigned int j = last_cluster_index; j < i; j++) {
-						w[j].end = glyph_info[i].cluster;
+			for (unsigned int i = 0; i < glyph_count; i++) {
+				if ((i > 0) && (last_cluster_id != glyph_info[i].cluster)) {
+					if (p_direction == HB_DIRECTION_RTL || p_direction == HB_DIRECTION_BTT) {
+						end = w[last_cluster_index].start;
+					} else {
+						for (unsigned int j = last_cluster_index; j < i; j++) {
+							w[j].end = glyph_info[i].cluster;
+						}
 					}
+					if (p_direction == HB_DIRECTION_RTL || p_direction == HB_DIRECTION_BTT) {
+						w[last_cluster_index].flags |= GRAPHEME_IS_RTL;
+					}
+					if (last_cluster_valid) {
+						w[last_cluster_index].flags |= GRAPHEME_IS_VALID;
+					}
+					w[last_cluster_index].count = i - last_cluster_index;
+					last_cluster_index = i;
+					last_cluster_valid = true;
 				}
-				if (p_direction == HB_DIRECTION_RTL || p_direction == HB_DIRECTION_BTT) {
-					w[last_cluster_index].flags |= GRAPHEME_IS_RTL;
-				}
-				if (last_cluster_valid) {
-					w[last_cluster_index].flags |= GRAPHEME_IS_VALID;
-				}
-				w[last_cluster_index].count = i - last_cluster_index;
-				last_cluster_index = i;
-				last_cluster_valid = true;
-			}
 
-			last_cluster_id = glyph_info[i].cluster;
+				last_cluster_id = glyph_info[i].cluster;
 
-			Glyph &gl = w[i];
-			gl = Glyph();
+				Glyph &gl = w[i];
+				gl = Glyph();
 
-			gl.start = glyph_info[i].cluster;
-			gl.end = end;
-			gl.count = 0;
+				gl.start = glyph_info[i].cluster;
+				gl.end = end;
+				gl.count = 0;
 
-			gl.font_rid = f;
-			gl.font_size = fs;
+				gl.font_rid = f;
+				gl.font_size = fs;
 
-			if (glyph_info[i].mask & HB_GLYPH_FLAG_UNSAFE_TO_BREAK) {
-				gl.flags |= GRAPHEME_IS_CONNECTED;
-			}
+				if (glyph_info[i].mask & HB_GLYPH_FLAG_UNSAFE_TO_BREAK) {
+					gl.flags |= GRAPHEME_IS_CONNECTED;
+				}
 
-#if HB_VERSION_ATLEAST(5, 1, 0)
-			if (glyph_info[i].mask & HB_GLYPH_FLAG_SAFE_TO_INSERT_TATWEEL) {
-				gl.flags |= GRAPHEME_IS_SAFE_TO_INSERT_TATWEEL;
-			}
-#endif
+	#if HB_VERSION_ATLEAST(5, 1, 0)
+				if (glyph_info[i].mask & HB_GLYPH_FLAG_SAFE_TO_INSERT_TATWEEL) {
+					gl.flags |= GRAPHEME_IS_SAFE_TO_INSERT_TATWEEL;
+				}
+	#endif
 
-			gl.index = glyph_info[i].codepoint;
-			if (gl.index != 0) {
-				_ensure_glyph(fd, fss, gl.index | mod);
-				if (p_sd->orientation == ORIENTATION_HORIZONTAL) {
+				gl.index = glyph_info[i].codepoint;
+				if (gl.index != 0) {
+					_ensure_glyph(fd, fss, gl.index | mod);
+					if (p_sd->orientation == ORIENTATION_HORIZONTAL) {
+						if (subpos) {
+							gl.advance = (double)glyph_pos[i].x_advance / (64.0 / scale) + ea;
+						} else {
+							gl.advance = Math::round((double)glyph_pos[i].x_advance / (64.0 / scale) + ea);
+						}
+					} else {
+						gl.advance = -Math::round((double)glyph_pos[i].y_advance / (64.0 / scale));
+					}
 					if (subpos) {
-						gl.advance = (double)glyph_pos[i].x_advance / (64.0 / scale) + ea;
+						gl.x_off = (double)glyph_pos[i].x_offset / (64.0 / scale);
 					} else {
-						gl.advance = Math::round((double)glyph_pos[i].x_advance / (64.0 / scale) + ea);
+						gl.x_off = Math::round((double)glyph_pos[i].x_offset / (64.0 / scale));
+					}
+					gl.y_off = -Math::round((double)glyph_pos[i].y_offset / (64.0 / scale));
+				}
+				if (!last_run || i < glyph_count - 1) {
+					// Do not add extra spacing to the last glyph of the string.
+					if (sp_sp && is_whitespace(p_sd->text[glyph_info[i].cluster])) {
+						gl.advance += sp_sp;
+					} else {
+						gl.advance += sp_gl;
 					}
-				} else {
-					gl.advance = -Math::round((double)glyph_pos[i].y_advance / (64.0 / scale));
 				}
-				if (subpos) {
-					gl.x_off = (double)glyph_pos[i].x_offset / (64.0 / scale);
+
+				if (p_sd->preserve_control) {
+					last_cluster_valid = last_cluster_valid && ((glyph_info[i].codepoint != 0) || (p_sd->text[glyph_info[i].cluster] == 0x0009) || (u_isblank(p_sd->text[glyph_info[i].cluster]) && (gl.advance != 0)) || (!u_isblank(p_sd->text[glyph_info[i].cluster]) && is_linebreak(p_sd->text[glyph_info[i].cluster])));
 				} else {
-					gl.x_off = Math::round((double)glyph_pos[i].x_offset / (64.0 / scale));
+					last_cluster_valid = last_cluster_valid && ((glyph_info[i].codepoint != 0) || (p_sd->text[glyph_info[i].cluster] == 0x0009) || (u_isblank(p_sd->text[glyph_info[i].cluster]) && (gl.advance != 0)) || (!u_isblank(p_sd->text[glyph_info[i].cluster]) && !u_isgraph(p_sd->text[glyph_info[i].cluster])));
 				}
-				gl.y_off = -Math::round((double)glyph_pos[i].y_offset / (64.0 / scale));
 			}
-			if (!last_run || i < glyph_count - 1) {
-				// Do not add extra spacing to the last glyph of the string.
-				if (sp_sp && is_whitespace(p_sd->text[glyph_info[i].cluster])) {
-					gl.advance += sp_sp;
-				} else {
-					gl.advance += sp_gl;
+			if (p_direction == HB_DIRECTION_LTR || p_direction == HB_DIRECTION_TTB) {
+				for (unsigned int j = last_cluster_index; j < glyph_count; j++) {
+					w[j].end = p_end;
 				}
 			}
-
-			if (p_sd->preserve_control) {
-				last_cluster_valid = last_cluster_valid && ((glyph_info[i].codepoint != 0) || (p_sd->text[glyph_info[i].cluster] == 0x0009) || (u_isblank(p_sd->text[glyph_info[i].cluster]) && (gl.advance != 0)) || (!u_isblank(p_sd->text[glyph_info[i].cluster]) && is_linebreak(p_sd->text[glyph_info[i].cluster])));
-			} else {
-				last_cluster_valid = last_cluster_valid && ((glyph_info[i].codepoint != 0) || (p_sd->text[glyph_info[i].cluster] == 0x0009) || (u_isblank(p_sd->text[glyph_info[i].cluster]) && (gl.advance != 0)) || (!u_isblank(p_sd->text[glyph_info[i].cluster]) && !u_isgraph(p_sd->text[glyph_info[i].cluster])));
+			w[last_cluster_index].count = glyph_count - last_cluster_index;
+			if (p_direction == HB_DIRECTION_RTL || p_direction == HB_DIRECTION_BTT) {
+				w[last_cluster_index].flags |= GRAPHEME_IS_RTL;
 			}
-		}
-		if (p_direction == HB_DIRECTION_LTR || p_direction == HB_DIRECTION_TTB) {
-			for (unsigned int j = last_cluster_index; j < glyph_count; j++) {
-				w[j].end = p_end;
+			if (last_cluster_valid) {
+				w[last_cluster_index].flags |= GRAPHEME_IS_VALID;
 			}
 		}
-		w[last_cluster_index].count = glyph_count - last_cluster_index;
-		if (p_direction == HB_DIRECTION_RTL || p_direction == HB_DIRECTION_BTT) {
-			w[last_cluster_index].flags |= GRAPHEME_IS_RTL;
-		}
-		if (last_cluster_valid) {
-			w[last_cluster_index].flags |= GRAPHEME_IS_VALID;
-		}
+	}
 
+	if (glyph_count > 0) {
 		// Fallback.
 		int failed_subrun_start = p_end + 1;
 		int failed_subrun_end = p_start;
@@ -5975,8 +6013,113 @@ void TextServerAdvanced::_shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_star
 	}
 }
 
+bool TextServerAdvanced::_shaping_cache_make_key(const ShapedTextDataAdvanced *p_sd, ShapingCacheKey &r_key) const {
+	if (p_sd->text.length() > SHAPING_CACHE_MAX_TEXT_LENGTH || !p_sd->objects.is_empty()) {
+		return false;
+	}
+
+	r_key.text = p_sd->text;
+	r_key.direction = p_sd->direction;
+	r_key.orientation = p_sd->orientation;
+	r_key.preserve_invalid = p_sd->preserve_invalid;
+	r_key.preserve_control = p_sd->preserve_control;
+	for (int i = 0; i < 4; i++) {
+		r_key.extra_spacing[i] = p_sd->extra_spacing[i];
+	}
+	r_key.bidi_override = p_sd->bidi_override;
+
+	bool use_locale = p_sd->spans.is_empty();
+	r_key.spans.resize(p_sd->spans.size());
+	for (int i = 0; i < p_sd->spans.size(); i++) {
+		const ShapedTextDataAdvanced::Span &span = p_sd->spans[i];
+		ShapingCacheKey::Span &key_span = r_key.spans.write[i];
+		key_span.start = span.start;
+		key_span.end = span.end;
+		key_span.fonts = span.fonts;
+		key_span.font_size = span.font_size;
+		key_span.language = span.language;
+		key_span.features = span.features;
+		use_locale = use_locale || span.language.is_empty();
+	}
+	if (use_locale) {
+		r_key.locale = TranslationServer::get_singleton()->get_tool_locale();
+	}
+	return true;
+}
+
+bool TextServerAdvanced::_shaping_cache_fetch(const ShapingCacheKey &p_key, ShapedTextDataAdvanced *p_sd) {
+	MutexLock lock(shaping_cache_mutex);
+	List<ShapingCacheRec>::Element **E = shaping_cache.getptr(p_key);
+	if (!E) {
+		return false;
+	}
+
+	const ShapingCacheRec &rec = (*E)->get();
+	for (int i = 0; i < rec.fonts.size(); i++) {
+		if (!font_owner.owns(rec.fonts[i]) && !font_var_owner.owns(rec.fonts[i])) {
+			// Font was freed (e.g. system fallback font cleanup), drop stale entry.
+			shaping_cache_lru.erase(*E);
+			shaping_cache.erase(p_key);
+			return false;
+		}
+	}
+	shaping_cache_lru.move_to_front(*E);
+
+	p_sd->glyphs = rec.glyphs;
+	p_sd->ascent = rec.ascent;
+	p_sd->descent = rec.descent;
+	p_sd->width = rec.width;
+	p_sd->upos = rec.upos;
+	p_sd->uthk = rec.uthk;
+	return true;
+}
+
+void TextServerAdvanced::_shaping_cache_store(const ShapingCacheKey &p_key, const ShapedTextDataAdvanced *p_sd) {
+	ShapingCacheRec rec;
+	rec.key = p_key;
+	rec.glyphs = p_sd->glyphs;
+	rec.ascent = p_sd->ascent;
+	rec.descent = p_sd->descent;
+	rec.width = p_sd->width;
+	rec.upos = p_sd->upos;
+	rec.uthk = p_sd->uthk;
+
+	RID last_font;
+	for (int i = 0; i < p_sd->glyphs.size(); i++) {
+		const RID &font = p_sd->glyphs[i].font_rid;
+		if (font.is_valid() && font != last_font && !rec.fonts.has(font)) {
+			rec.fonts.push_back(font);
+		}
+		last_font = font;
+	}
+
+	MutexLock lock(shaping_cache_mutex);
+	List<ShapingCacheRec>::Element **E = shaping_cache.getptr(p_key);
+	if (E) {
+		// Shaped by another thread in the meantime.
+		shaping_cache_lru.erase(*E);
+		shaping_cache.erase(p_key);
+	}
+	shaping_cache[p_key] = shaping_cache_lru.push_front(rec);
+
+	while (shaping_cache_lru.size() > SHAPING_CACHE_MAX_ENTRIES) {
+		shaping_cache.erase(shaping_cache_lru.back()->get().key);
+		shaping_cache_lru.pop_back();
+	}
+}
+
+void TextServerAdvanced::_shaping_cache_clear() {
+	MutexLock lock(shaping_cache_mutex);
+	shaping_cache.clear();
+	shaping_cache_lru.clear();
+}
+
 bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 	_THREAD_SAFE_METHOD_
+	return _shape_text(p_shaped);
+}
+
+bool TextServerAdvanced::_shape_text(const RID &p_shaped) {
 	ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, false);
 
@@ -6037,6 +6180,11 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 		sd->bidi_override.push_back(Vector3i(sd->start, sd->end, DIRECTION_INHERITED));
 	}
 
+	// Reuse glyphs of an identical paragraph, only BiDi iterators are rebuilt (these are used for substrings).
+	ShapingCacheKey cache_key;
+	bool cacheable = _shaping_cache_make_key(sd, cache_key);
+	bool cached = cacheable && _shaping_cache_fetch(cache_key, sd);
+
 	for (int ov = 0; ov < sd->bidi_override.size(); ov++) {
 		// Create BiDi iterator.
 		int start = _convert_pos_inv(sd, sd->bidi_override[ov].x - sd->start);
@@ -6078,6 +6226,9 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 			ERR_PRINT(vformat("BiDi iterator allocation for the paragraph failed: %s", u_errorName(err)));
 		}
 		sd->bidi_iter.push_back(bidi_iter);
+		if (cached) {
+			continue;
+		}
 
 		err = U_ZERO_ERROR;
 		int bidi_run_count = 1;
@@ -6187,11 +6338,48 @@ bool TextServerAdvanced::_shaped_text_shape(const RID &p_shaped) {
 		}
 	}
 
-	_realign(sd);
+	if (!cached) {
+		_realign(sd);
+		if (cacheable) {
+			_shaping_cache_store(cache_key, sd);
+		}
+	}
 	sd->valid = true;
 	return sd->valid;
 }
 
+void TextServerAdvanced::_shape_text_threaded(void *p_td, uint32_t p_index) {
+	ShapeBatchData *td = static_cast<ShapeBatchData *>(p_td);
+	td->server->_shape_text(td->paragraphs[p_index]);
+}
+
+bool TextServerAdvanced::_shaped_text_shape_batch(const TypedArray<RID> &p_shaped) {
+	// Top level paragraphs are shaped in parallel, each one uses its own HarfBuzz buffer.
+	ShapeBatchData td;
+	td.server = this;
+	for (int i = 0; i < p_shaped.size(); i++) {
+		ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped[i]);
+		ERR_FAIL_NULL_V(sd, false);
+
+		MutexLock lock(sd->mutex);
+		if (!sd->valid && sd->parent == RID()) {
+			td.paragraphs.push_back(p_shaped[i]);
+		}
+	}
+
+	if (td.paragraphs.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&TextServerAdvanced::_shape_text_threaded, &td, td.paragraphs.size(), -1, true, String("TextServerShapeParagraphs"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	}
+
+	// Shape substrings and single paragraphs, already shaped buffers are skipped.
+	bool ret = true;
+	for (int i = 0; i < p_shaped.size(); i++) {
+		ret = _shaped_text_shape(p_shaped[i]) && ret;
+	}
+	return ret;
+}
+
 bool TextServerAdvanced::_shaped_text_is_ready(const RID &p_shaped) const {
 	const ShapedTextDataAdvanced *sd = shaped_owner.get_or_null(p_shaped);
 	ERR_FAIL_NULL_V(sd, false);
@@ -7084,6 +7272,8 @@ void TextServerAdvanced::_cleanup() {
 	}
 	system_fonts.clear();
 	system_font_data.clear();
+
+	_shaping_cache_clear();
 }
 
 TextServerAdvanced::~TextServerAdvanced() {
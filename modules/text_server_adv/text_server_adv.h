@@ -73,6 +73,7 @@
 
 #include <godot_cpp/templates/hash_map.hpp>
 #include <godot_cpp/templates/hash_set.hpp>
+#include <godot_cpp/templates/list.hpp>
 #include <godot_cpp/templates/rid_owner.hpp>
 #include <godot_cpp/templates/vector.hpp>
 
@@ -84,6 +85,7 @@ using namespace godot;
 #include "core/extension/ext_wrappers.gen.inc"
 #include "core/object/worker_thread_pool.h"
 #include "core/templates/hash_map.h"
+#include "core/templates/list.h"
 #include "core/templates/rid_owner.h"
 #include "scene/resources/image_texture.h"
 #include "servers/text/text_server_extension.h"
@@ -541,9 +543,9 @@ class TextServerAdvanced : public TextServerExtension {
 	// Common data.
 
 	double oversampling = 1.0;
-	mutable RID_PtrOwner<FontAdvancedLinkedVariation> font_var_owner;
-	mutable RID_PtrOwner<FontAdvanced> font_owner;
-	mutable RID_PtrOwner<ShapedTextDataAdvanced> shaped_owner;
+	mutable RID_PtrOwner<FontAdvancedLinkedVariation, true> font_var_owner; // Thread-safe, fonts are accessed from parallel shaping tasks.
+	mutable RID_PtrOwner<FontAdvanced, true> font_owner;
+	mutable RID_PtrOwner<ShapedTextDataAdvanced, true> shaped_owner;
 
 	_FORCE_INLINE_ FontAdvanced *_get_font_data(const RID &p_font_rid) const {
 		RID rid = p_font_rid;
@@ -639,12 +641,119 @@ class TextServerAdvanced : public TextServerExtension {
 	mutable HashMap<SystemFontKey, SystemFontCache, SystemFontKeyHasher> system_fonts;
 	mutable HashMap<String, PackedByteArray> system_font_data;
 
+	// Shaped paragraph cache, lets text buffers with identical source data reuse glyphs.
+
+	const int SHAPING_CACHE_MAX_ENTRIES = 4096;
+	const int SHAPING_CACHE_MAX_TEXT_LENGTH = 1024;
+
+	struct ShapingCacheKey {
+		struct Span {
+			int start = -1;
+			int end = -1;
+			Array fonts;
+			int font_size = 0;
+			String language;
+			Dictionary features;
+		};
+
+		String text;
+		TextServer::Direction direction = DIRECTION_LTR;
+		TextServer::Orientation orientation = ORIENTATION_HORIZONTAL;
+		bool preserve_invalid = true;
+		bool preserve_control = false;
+		int extra_spacing[4] = { 0, 0, 0, 0 };
+		String locale; // Tool locale, only set if any span has no language.
+		Vector<Vector3i> bidi_override;
+		Vector<Span> spans;
+
+		bool operator==(const ShapingCacheKey &p_b) const {
+			if (text != p_b.text || direction != p_b.direction || orientation != p_b.orientation || preserve_invalid != p_b.preserve_invalid || preserve_control != p_b.preserve_control || locale != p_b.locale) {
+				return false;
+			}
+			for (int i = 0; i < 4; i++) {
+				if (extra_spacing[i] != p_b.extra_spacing[i]) {
+					return false;
+				}
+			}
+			if (bidi_override.size() != p_b.bidi_override.size() || spans.size() != p_b.spans.size()) {
+				return false;
+			}
+			for (int i = 0; i < bidi_override.size(); i++) {
+				if (bidi_override[i] != p_b.bidi_override[i]) {
+					return false;
+				}
+			}
+			for (int i = 0; i < spans.size(); i++) {
+				const Span &a = spans[i];
+				const Span &b = p_b.spans[i];
+				if (a.start != b.start || a.end != b.end || a.font_size != b.font_size || a.language != b.language || a.fonts != b.fonts || a.features != b.features) {
+					return false;
+				}
+			}
+			return true;
+		}
+	};
+
+	struct ShapingCacheKeyHasher {
+		_FORCE_INLINE_ static uint32_t hash(const ShapingCacheKey &p_a) {
+			uint32_t hash = p_a.text.hash();
+			hash = hash_murmur3_one_32(p_a.locale.hash(), hash);
+			for (int i = 0; i < 4; i++) {
+				hash = hash_murmur3_one_32(p_a.extra_spacing[i], hash);
+			}
+			for (int i = 0; i < p_a.bidi_override.size(); i++) {
+				hash = hash_murmur3_one_32(p_a.bidi_override[i].x, hash);
+				hash = hash_murmur3_one_32(p_a.bidi_override[i].y, hash);
+				hash = hash_murmur3_one_32(p_a.bidi_override[i].z, hash);
+			}
+			for (int i = 0; i < p_a.spans.size(); i++) {
+				const ShapingCacheKey::Span &span = p_a.spans[i];
+				hash = hash_murmur3_one_32(span.start, hash);
+				hash = hash_murmur3_one_32(span.end, hash);
+				hash = hash_murmur3_one_32(span.font_size, hash);
+				hash = hash_murmur3_one_32(span.fonts.hash(), hash);
+				hash = hash_murmur3_one_32(span.language.hash(), hash);
+				hash = hash_murmur3_one_32(span.features.hash(), hash);
+			}
+
+			return hash_fmix32(hash_murmur3_one_32(((int)p_a.direction) | ((int)p_a.orientation << 4) | ((int)p_a.preserve_invalid << 8) | ((int)p_a.preserve_control << 9), hash));
+		}
+	};
+
+	struct ShapingCacheRec {
+		ShapingCacheKey key;
+
+		Vector<Glyph> glyphs;
+		Vector<RID> fonts; // Fonts used by the glyphs, checked before reuse.
+		double ascent = 0.0;
+		double descent = 0.0;
+		double width = 0.0;
+		double upos = 0.0;
+		double uthk = 0.0;
+	};
+
+	Mutex shaping_cache_mutex;
+	List<ShapingCacheRec> shaping_cache_lru; // Most recently used first.
+	HashMap<ShapingCacheKey, List<ShapingCacheRec>::Element *, ShapingCacheKeyHasher> shaping_cache;
+
+	bool _shaping_cache_make_key(const ShapedTextDataAdvanced *p_sd, ShapingCacheKey &r_key) const;
+	bool _shaping_cache_fetch(const ShapingCacheKey &p_key, ShapedTextDataAdvanced *p_sd);
+	void _shaping_cache_store(const ShapingCacheKey &p_key, const ShapedTextDataAdvanced *p_sd);
+	void _shaping_cache_clear();
+
+	struct ShapeBatchData {
+		TextServerAdvanced *server = nullptr;
+		Vector<RID> paragraphs;
+	};
+	static void _shape_text_threaded(void *p_td, uint32_t p_index);
+
 	void _update_chars(ShapedTextDataAdvanced *p_sd) const;
 	void _realign(ShapedTextDataAdvanced *p_sd) const;
 	int64_t _convert_pos(const String &p_utf32, const Char16String &p_utf16, int64_t p_pos) const;
 	int64_t _convert_pos(const ShapedTextDataAdvanced *p_sd, int64_t p_pos) const;
 	int64_t _convert_pos_inv(const ShapedTextDataAdvanced *p_sd, int64_t p_pos) const;
 	bool _shape_substr(ShapedTextDataAdvanced *p_new_sd, const ShapedTextDataAdvanced *p_sd, int64_t p_start, int64_t p_length) const;
+	bool _shape_text(const RID &p_shaped); // Server is not locked, only the system font fallback is.
 	void _shape_run(ShapedTextDataAdvanced *p_sd, int64_t p_start, int64_t p_end, hb_script_t p_script, hb_direction_t p_direction, TypedArray<RID> p_fonts, int64_t p_span, int64_t p_fb_index, int64_t p_prev_start, int64_t p_prev_end);
 	Glyph _shape_single_glyph(ShapedTextDataAdvanced *p_sd, char32_t p_char, hb_script_t p_script, hb_direction_t p_direction, const RID &p_font, int64_t p_font_size);
 
@@ -926,6 +1035,7 @@ public:
 	MODBIND2R(double, shaped_text_tab_align, const RID &, const PackedFloat32Array &);
 
 	MODBIND1R(bool, shaped_text_shape, const RID &);
+	MODBIND1R(bool, shaped_text_shape_batch, const TypedArray<RID> &);
 	MODBIND1R(bool, shaped_text_update_breaks, const RID &);
 	MODBIND1R(bool, shaped_text_update_justification_ops, const RID &);
 
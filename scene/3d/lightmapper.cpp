@@ -30,6 +30,8 @@
 
 #include "lightmapper.h"
 
+#include "core/config/project_settings.h"
+
 LightmapDenoiser *(*LightmapDenoiser::create_function)() = nullptr;
 
 Ref<LightmapDenoiser> LightmapDenoiser::create() {
@@ -58,6 +60,10 @@ Ref<Lightmapper> Lightmapper::create() {
 		lm = create_custom();
 	}
 
+	if (!lm && create_cpu && bool(GLOBAL_GET("rendering/lightmapping/bake_performance/use_cpu_lightmapper"))) {
+		lm = create_cpu();
+	}
+
 	if (!lm && create_gpu) {
 		lm = create_gpu();
 	}
@@ -31,6 +31,7 @@
 #include "node_3d.h"
 
 #include "core/object/message_queue.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/3d/visual_instance_3d.h"
 #include "scene/main/viewport.h"
 #include "scene/property_utils.h"
@@ -373,6 +374,106 @@ Transform3D Node3D::get_global_transform() const {
 	return data.global_transform;
 }
 
+void Node3D::_resolve_global_transform_task(void *p_userdata, uint32_t p_index) {
+	Node3D *const *nodes = (Node3D *const *)p_userdata;
+	// The parent was resolved in a previous level (or was not dirty), so this never recurses.
+	nodes[p_index]->get_global_transform();
+}
+
+void Node3D::resolve_global_transforms(const SelfList<Node>::List &p_list) {
+	// Below this many dirty nodes in total, gathering and sorting them costs more than
+	// resolving them lazily from the notifications.
+	const uint32_t MIN_GATHERED_NODES = 256;
+	// Below this many nodes in a level, dispatching to threads costs more than it saves.
+	const uint32_t MIN_PARALLEL_LEVEL_SIZE = 64;
+
+	uint32_t listed = 0;
+	for (const SelfList<Node> *E = p_list.first(); E && listed < MIN_GATHERED_NODES; E = E->next()) {
+		listed++;
+	}
+	if (listed < MIN_GATHERED_NODES) {
+		return; // Not worth it, let the notifications resolve them lazily.
+	}
+
+	// Gather every node whose global transform is dirty, along with the dirty ancestors it depends on.
+	// Each one gets a level that is greater than the level of its parent, if the parent is dirty too.
+	HashMap<const Node3D *, uint32_t> levels;
+	LocalVector<Node3D *> gathered;
+	LocalVector<uint32_t> gathered_levels;
+	LocalVector<Node3D *> chain;
+	uint32_t level_count = 0;
+
+	for (const SelfList<Node> *E = p_list.first(); E; E = E->next()) {
+		Node3D *node = Object::cast_to<Node3D>(E->self());
+		if (!node) {
+			continue;
+		}
+
+		chain.clear();
+		int level = -1;
+		while (node) {
+			HashMap<const Node3D *, uint32_t>::Iterator L = levels.find(node);
+			if (L) {
+				level = L->value;
+				break;
+			}
+			if (!node->_test_dirty_bits(DIRTY_GLOBAL_TRANSFORM)) {
+				break;
+			}
+			chain.push_back(node);
+			if (node->data.top_level) {
+				break;
+			}
+			node = node->data.parent;
+		}
+
+		for (int64_t i = int64_t(chain.size()) - 1; i >= 0; i--) {
+			level++;
+			levels.insert(chain[i], level);
+			gathered.push_back(chain[i]);
+			gathered_levels.push_back(level);
+			level_count = MAX(level_count, uint32_t(level) + 1);
+		}
+	}
+
+	if (gathered.size() < MIN_GATHERED_NODES) {
+		return; // Most of the listed nodes were not dirty Node3Ds.
+	}
+
+	// Counting sort by level, so that each level is contiguous in memory.
+	LocalVector<uint32_t> level_offsets;
+	level_offsets.resize(level_count + 1);
+	memset(level_offsets.ptr(), 0, level_offsets.size() * sizeof(uint32_t));
+	for (uint32_t i = 0; i < gathered.size(); i++) {
+		level_offsets[gathered_levels[i] + 1]++;
+	}
+	for (uint32_t i = 0; i < level_count; i++) {
+		level_offsets[i + 1] += level_offsets[i];
+	}
+
+	LocalVector<Node3D *> sorted;
+	sorted.resize(gathered.size());
+	{
+		LocalVector<uint32_t> cursor = level_offsets;
+		for (uint32_t i = 0; i < gathered.size(); i++) {
+			sorted[cursor[gathered_levels[i]]++] = gathered[i];
+		}
+	}
+
+	for (uint32_t i = 0; i < level_count; i++) {
+		uint32_t from = level_offsets[i];
+		uint32_t count = level_offsets[i + 1] - from;
+		if (count >= MIN_PARALLEL_LEVEL_SIZE) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&Node3D::_resolve_global_transform_task, sorted.ptr() + from, count, -1, true, SNAME("Node3DResolveGlobalTransforms"));
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		} else {
+			for (uint32_t j = 0; j < count; j++) {
+				sorted[from + j]->get_global_transform();
+			}
+		}
+	}
+}
+
 #ifdef TOOLS_ENABLED
 Transform3D Node3D::get_global_gizmo_transform() const {
 	return get_global_transform();
@@ -51,6 +51,8 @@ public:
 class Node3D : public Node {
 	GDCLASS(Node3D, Node);
 
+	friend class TestNode3DAccessor;
+
 public:
 	// Edit mode for the rotation.
 	// THIS MODE ONLY AFFECTS HOW DATA IS EDITED AND SAVED
@@ -144,6 +146,8 @@ private:
 	void _update_visibility_parent(bool p_update_root);
 	void _propagate_transform_changed_deferred();
 
+	static void _resolve_global_transform_task(void *p_userdata, uint32_t p_index);
+
 protected:
 	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) { data.ignore_notification = p_ignore; }
 
@@ -167,6 +171,10 @@ public:
 		NOTIFICATION_LOCAL_TRANSFORM_CHANGED = 44,
 	};
 
+	// Computes the dirty global transforms of the given nodes and their dirty ancestors ahead of time,
+	// one hierarchy level at a time with each level split across the WorkerThreadPool.
+	static void resolve_global_transforms(const SelfList<Node>::List &p_list);
+
 	Node3D *get_parent_node_3d() const;
 
 	Ref<World3D> get_world_3d() const;
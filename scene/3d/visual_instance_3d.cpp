@@ -33,6 +33,9 @@
 #include "core/core_string_names.h"
 #include "scene/scene_string_names.h"
 
+SelfList<VisualInstance3D>::List VisualInstance3D::transform_update_list;
+bool VisualInstance3D::batch_transform_updates = false;
+
 AABB VisualInstance3D::get_aabb() const {
 	AABB ret;
 	GDVIRTUAL_CALL(_get_aabb, ret);
@@ -56,11 +59,20 @@ void VisualInstance3D::_notification(int p_what) {
 		} break;
 
 		case NOTIFICATION_TRANSFORM_CHANGED: {
-			Transform3D gt = get_global_transform();
-			RenderingServer::get_singleton()->instance_set_transform(instance, gt);
+			if (batch_transform_updates && Thread::is_main_thread()) {
+				if (!transform_update_item.in_list()) {
+					transform_update_list.add(&transform_update_item);
+				}
+			} else {
+				Transform3D gt = get_global_transform();
+				RenderingServer::get_singleton()->instance_set_transform(instance, gt);
+			}
 		} break;
 
 		case NOTIFICATION_EXIT_WORLD: {
+			if (transform_update_item.in_list()) {
+				transform_update_list.remove(&transform_update_item);
+			}
 			RenderingServer::get_singleton()->instance_set_scenario(instance, RID());
 			RenderingServer::get_singleton()->instance_attach_skeleton(instance, RID());
 		} break;
@@ -156,7 +168,52 @@ RID VisualInstance3D::get_base() const {
 	return base;
 }
 
-VisualInstance3D::VisualInstance3D() {
+void VisualInstance3D::set_batch_transform_updates(bool p_enabled) {
+	if (!p_enabled) {
+		// Don't leave queued transforms behind, nothing would send them anymore.
+		flush_transform_updates();
+	}
+	batch_transform_updates = p_enabled;
+}
+
+bool VisualInstance3D::is_batching_transform_updates() {
+	return batch_transform_updates;
+}
+
+void VisualInstance3D::flush_transform_updates() {
+	int count = 0;
+	for (SelfList<VisualInstance3D> *E = transform_update_list.first(); E; E = E->next()) {
+		count++;
+	}
+	if (count == 0) {
+		return;
+	}
+
+	Vector<RID> instances;
+	Vector<Transform3D> transforms;
+	instances.resize(count);
+	transforms.resize(count);
+	RID *w_instances = instances.ptrw();
+	Transform3D *w_transforms = transforms.ptrw();
+
+	int i = 0;
+	SelfList<VisualInstance3D> *E = transform_update_list.first();
+	while (E) {
+		VisualInstance3D *vi = E->self();
+		SelfList<VisualInstance3D> *N = E->next();
+		transform_update_list.remove(E);
+		E = N;
+
+		w_instances[i] = vi->instance;
+		w_transforms[i] = vi->get_global_transform();
+		i++;
+	}
+
+	RenderingServer::get_singleton()->instance_set_transforms(instances, transforms);
+}
+
+VisualInstance3D::VisualInstance3D() :
+		transform_update_item(this) {
 	instance = RenderingServer::get_singleton()->instance_create();
 	RenderingServer::get_singleton()->instance_attach_object_instance_id(instance, get_instance_id());
 	set_notify_transform(true);
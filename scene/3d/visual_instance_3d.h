@@ -42,6 +42,16 @@ class VisualInstance3D : public Node3D {
 	float sorting_offset = 0.0;
 	bool sorting_use_aabb_center = true;
 
+	// Instances whose transform changed this frame, when batching is enabled
+	// with the "application/run/batch_instance_transform_updates" setting.
+	// They are sent to the RenderingServer in a single batch by
+	// flush_transform_updates(), which SceneTree calls once per frame. Until
+	// then, RenderingServer queries such as instances_cull_ray() see the
+	// previous transforms, so call it first when they must be up to date.
+	SelfList<VisualInstance3D> transform_update_item;
+	static SelfList<VisualInstance3D>::List transform_update_list;
+	static bool batch_transform_updates;
+
 protected:
 	void _update_visibility();
 
@@ -76,6 +86,10 @@ public:
 	void set_sorting_use_aabb_center(bool p_enabled);
 	bool is_sorting_use_aabb_center() const;
 
+	static void set_batch_transform_updates(bool p_enabled);
+	static bool is_batching_transform_updates();
+	static void flush_transform_updates();
+
 	VisualInstance3D();
 	~VisualInstance3D();
 };
@@ -572,6 +572,8 @@ void PropertyTweener::start() {
 	}
 
 	delta_val = Animation::subtract_variant(final_val, initial_val);
+	_update_value_cache();
+	_resolve_setter(target_instance);
 }
 
 bool PropertyTweener::step(double &r_delta) {
@@ -592,16 +594,17 @@ bool PropertyTweener::step(double &r_delta) {
 	} else if (do_continue_delayed && !Math::is_zero_approx(delay)) {
 		initial_val = target_instance->get_indexed(property);
 		delta_val = Animation::subtract_variant(final_val, initial_val);
+		_update_value_cache();
 		do_continue_delayed = false;
 	}
 
 	double time = MIN(elapsed_time - delay, duration);
 	if (time < duration) {
-		target_instance->set_indexed(property, tween->interpolate_variant(initial_val, delta_val, time, duration, trans_type, ease_type));
+		_set_value(target_instance, _interpolate(time));
 		r_delta = 0;
 		return true;
 	} else {
-		target_instance->set_indexed(property, final_val);
+		_set_value(target_instance, final_val);
 		finished = true;
 		r_delta = elapsed_time - delay - duration;
 		emit_signal(SNAME("finished"));
@@ -609,6 +612,130 @@ bool PropertyTweener::step(double &r_delta) {
 	}
 }
 
+template <typename T>
+static void _store_components(const T &p_from, const T &p_to, int p_count, real_t *r_from, real_t *r_to) {
+	for (int i = 0; i < p_count; i++) {
+		r_from[i] = p_from[i];
+		r_to[i] = p_to[i];
+	}
+}
+
+void PropertyTweener::_update_value_cache() {
+	value_type = VALUE_VARIANT;
+	if (trans_type < 0 || trans_type >= Tween::TRANS_MAX || ease_type < 0 || ease_type >= Tween::EASE_MAX) {
+		return; // Let Tween::interpolate_variant() report it.
+	}
+
+	Variant to = Animation::add_variant(initial_val, delta_val);
+	if (to.get_type() != initial_val.get_type()) {
+		return;
+	}
+
+	switch (initial_val.get_type()) {
+		case Variant::FLOAT: {
+			value_type = VALUE_FLOAT;
+			from_components[0] = initial_val;
+			to_components[0] = to;
+		} break;
+		case Variant::VECTOR2: {
+			value_type = VALUE_VECTOR2;
+			_store_components<Vector2>(initial_val, to, 2, from_components, to_components);
+		} break;
+		case Variant::VECTOR3: {
+			value_type = VALUE_VECTOR3;
+			_store_components<Vector3>(initial_val, to, 3, from_components, to_components);
+		} break;
+		case Variant::VECTOR4: {
+			value_type = VALUE_VECTOR4;
+			_store_components<Vector4>(initial_val, to, 4, from_components, to_components);
+		} break;
+		case Variant::COLOR: {
+			value_type = VALUE_COLOR;
+			_store_components<Color>(initial_val, to, 4, from_components, to_components);
+		} break;
+		default: {
+		} break;
+	}
+}
+
+void PropertyTweener::_resolve_setter(Object *p_target) {
+	setter = nullptr;
+	setter_index = -1;
+
+	// Scripts and extensions can intercept set(), so only native classes without a script qualify.
+	if (property.size() != 1 || p_target->get_script_instance()) {
+		return;
+	}
+#ifdef TOOLS_ENABLED
+	if (Engine::get_singleton()->is_editor_hint()) {
+		return; // set() also marks the object as edited.
+	}
+#endif
+
+	const StringName class_name = p_target->get_class_name();
+	ClassDB::APIType api = ClassDB::get_api_type(class_name);
+	if (api != ClassDB::API_CORE && api != ClassDB::API_EDITOR) {
+		return;
+	}
+
+	StringName setter_name = ClassDB::get_property_setter(class_name, property[0]);
+	if (setter_name == StringName()) {
+		return;
+	}
+	setter = ClassDB::get_method(class_name, setter_name);
+	setter_index = ClassDB::get_property_index(class_name, property[0]);
+}
+
+Variant PropertyTweener::_interpolate(double p_time) const {
+	if (value_type == VALUE_VARIANT) {
+		return tween->interpolate_variant(initial_val, delta_val, p_time, duration, trans_type, ease_type);
+	}
+
+	// Same operations as Animation::interpolate_variant(), so that both paths give identical results.
+	float weight = Tween::run_equation(trans_type, ease_type, p_time, 0.0, 1.0, duration);
+
+	if (value_type == VALUE_COLOR) {
+		float c[4];
+		for (int i = 0; i < 4; i++) {
+			c[i] = Math::lerp(float(from_components[i]), float(to_components[i]), weight);
+		}
+		return Color(c[0], c[1], c[2], c[3]);
+	}
+
+	real_t v[4];
+	for (int i = 0; i < 4; i++) {
+		v[i] = Math::lerp(from_components[i], to_components[i], real_t(weight));
+	}
+
+	switch (value_type) {
+		case VALUE_FLOAT:
+			return v[0];
+		case VALUE_VECTOR2:
+			return Vector2(v[0], v[1]);
+		case VALUE_VECTOR3:
+			return Vector3(v[0], v[1], v[2]);
+		default:
+			return Vector4(v[0], v[1], v[2], v[3]);
+	}
+}
+
+void PropertyTweener::_set_value(Object *p_target, const Variant &p_value) {
+	if (!setter || p_target->get_script_instance()) {
+		p_target->set_indexed(property, p_value);
+		return;
+	}
+
+	Callable::CallError ce;
+	if (setter_index >= 0) {
+		Variant index = setter_index;
+		const Variant *args[2] = { &index, &p_value };
+		setter->call(p_target, args, 2, ce);
+	} else {
+		const Variant *args[1] = { &p_value };
+		setter->call(p_target, args, 1, ce);
+	}
+}
+
 void PropertyTweener::set_tween(const Ref<Tween> &p_tween) {
 	tween = p_tween;
 	if (trans_type == Tween::TRANS_MAX) {
@@ -33,8 +33,9 @@
 
 #include "core/object/ref_counted.h"
 
-class Tween;
+class MethodBind;
 class Node;
+class Tween;
 
 class Tweener : public RefCounted {
 	GDCLASS(Tweener, RefCounted);
@@ -230,6 +231,29 @@ private:
 	bool do_continue = true;
 	bool do_continue_delayed = false;
 	bool relative = false;
+
+	// Common vector types are interpolated component-wise, without Variant arithmetic on each step.
+	enum ValueType {
+		VALUE_VARIANT,
+		VALUE_FLOAT,
+		VALUE_VECTOR2,
+		VALUE_VECTOR3,
+		VALUE_VECTOR4,
+		VALUE_COLOR,
+	};
+
+	ValueType value_type = VALUE_VARIANT;
+	real_t from_components[4] = {};
+	real_t to_components[4] = {};
+
+	// Native setter of the property, resolved on start() so that steps skip the property lookup.
+	MethodBind *setter = nullptr;
+	int setter_index = -1;
+
+	void _update_value_cache();
+	void _resolve_setter(Object *p_target);
+	Variant _interpolate(double p_time) const;
+	void _set_value(Object *p_target, const Variant &p_value);
 };
 
 class IntervalTweener : public Tweener {
@@ -33,7 +33,6 @@
 #include "container.h"
 #include "core/config/project_settings.h"
 #include "core/math/geometry_2d.h"
-#include "core/object/message_queue.h"
 #include "core/os/keyboard.h"
 #include "core/os/os.h"
 #include "core/string/print_string.h"
@@ -1625,7 +1624,7 @@ void Control::update_minimum_size() {
 	}
 	data.updating_last_minimum_size = true;
 
-	MessageQueue::get_singleton()->push_callable(callable_mp(this, &Control::_update_minimum_size));
+	get_viewport()->_gui_queue_minimum_size_update(this);
 }
 
 void Control::set_block_minimum_size_adjust(bool p_block) {
@@ -1829,6 +1828,10 @@ bool Control::has_point(const Point2 &p_point) const {
 	return Rect2(Point2(), get_size()).has_point(p_point);
 }
 
+bool Control::_has_point_outside_rect() const {
+	return GDVIRTUAL_IS_OVERRIDDEN(_has_point);
+}
+
 void Control::set_mouse_filter(MouseFilter p_filter) {
 	ERR_MAIN_THREAD_GUARD;
 	ERR_FAIL_INDEX(p_filter, 3);
@@ -1838,6 +1841,7 @@ void Control::set_mouse_filter(MouseFilter p_filter) {
 	}
 
 	data.mouse_filter = p_filter;
+	_invalidate_gui_pick_index();
 	notify_property_list_changed();
 	update_configuration_warnings();
 
@@ -2430,6 +2434,7 @@ void Control::set_clip_contents(bool p_clip) {
 		return;
 	}
 	data.clip_contents = p_clip;
+	_invalidate_gui_pick_index();
 	queue_redraw();
 }
 
@@ -3172,6 +3177,8 @@ void Control::_notification(int p_notification) {
 
 		case NOTIFICATION_POST_ENTER_TREE: {
 			data.is_rtl_dirty = true;
+			// An update queued before leaving the tree may belong to another viewport.
+			data.updating_last_minimum_size = false;
 			update_minimum_size();
 			_size_changed();
 		} break;
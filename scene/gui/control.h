@@ -334,6 +334,12 @@ protected:
 
 	virtual void _update_theme_item_cache();
 
+	// Input events.
+
+	// Whether has_point() may accept points outside of the control's rect. The viewport only asks
+	// controls returning false when the point falls within their rect.
+	virtual bool _has_point_outside_rect() const;
+
 	// Internationalization.
 
 	virtual TypedArray<Vector3i> structured_text_parser(TextServer::StructuredTextParser p_parser_type, const Array &p_args, const String &p_text) const;
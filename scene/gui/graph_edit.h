@@ -53,6 +53,7 @@ class GraphEditFilter : public Control {
 	GraphEdit *ge = nullptr;
 
 	virtual bool has_point(const Point2 &p_point) const override;
+	virtual bool _has_point_outside_rect() const override { return true; }
 
 public:
 	GraphEditFilter(GraphEdit *p_edit);
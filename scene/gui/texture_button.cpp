@@ -118,6 +118,11 @@ bool TextureButton::has_point(const Point2 &p_point) const {
 	return Control::has_point(p_point);
 }
 
+bool TextureButton::_has_point_outside_rect() const {
+	// The click mask can be larger than the button when no texture is drawn.
+	return click_mask.is_valid() || Control::_has_point_outside_rect();
+}
+
 void TextureButton::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_DRAW: {
@@ -314,6 +319,7 @@ void TextureButton::set_click_mask(const Ref<BitMap> &p_click_mask) {
 		return;
 	}
 	click_mask = p_click_mask;
+	_invalidate_gui_pick_index();
 	_texture_changed();
 }
 
@@ -70,6 +70,7 @@ private:
 protected:
 	virtual Size2 get_minimum_size() const override;
 	virtual bool has_point(const Point2 &p_point) const override;
+	virtual bool _has_point_outside_rect() const override;
 	void _notification(int p_what);
 	static void _bind_methods();
 
@@ -66,6 +66,8 @@ void CanvasItem::_propagate_visibility_changed(bool p_parent_visible_in_tree) {
 		return;
 	}
 
+	// Hiding or showing a parent (such as a CanvasLayer or a Window) changes which Controls can be picked.
+	_invalidate_gui_pick_index();
 	_handle_visibility_change(p_parent_visible_in_tree);
 }
 
@@ -76,6 +78,7 @@ void CanvasItem::set_visible(bool p_visible) {
 	}
 
 	visible = p_visible;
+	_invalidate_gui_pick_index();
 
 	if (!parent_visible_in_tree) {
 		notification(NOTIFICATION_VISIBILITY_CHANGED);
@@ -264,6 +267,7 @@ void CanvasItem::_enter_canvas() {
 
 void CanvasItem::_exit_canvas() {
 	notification(NOTIFICATION_EXIT_CANVAS, true); //reverse the notification
+	_invalidate_gui_pick_index();
 	RenderingServer::get_singleton()->canvas_item_set_parent(canvas_item, RID());
 	canvas_layer = nullptr;
 	if (canvas_group != StringName()) {
@@ -396,6 +400,13 @@ void CanvasItem::_window_visibility_changed() {
 	_propagate_visibility_changed(window->is_visible());
 }
 
+void CanvasItem::_invalidate_gui_pick_index(bool p_transform_changed) {
+	Viewport *viewport = get_viewport();
+	if (viewport) {
+		viewport->_gui_invalidate_pick_index(this, p_transform_changed);
+	}
+}
+
 void CanvasItem::queue_redraw() {
 	ERR_THREAD_GUARD; // Calling from thread is safe.
 	if (!is_inside_tree()) {
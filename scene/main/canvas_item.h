@@ -150,8 +150,11 @@ private:
 	void _notify_transform_deferred();
 
 protected:
+	void _invalidate_gui_pick_index(bool p_transform_changed = false);
+
 	_FORCE_INLINE_ void _notify_transform() {
 		_notify_transform(this);
+		_invalidate_gui_pick_index(true);
 		if (is_inside_tree() && !block_transform_notify && notify_local_transform) {
 			notification(NOTIFICATION_LOCAL_TRANSFORM_CHANGED);
 		}
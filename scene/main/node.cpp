@@ -1310,6 +1310,7 @@ void Node::set_name(const String &p_name) {
 		data.parent->_validate_child_name(this, true);
 		bool success = data.parent->data.children.replace_key(old_name, data.name);
 		ERR_FAIL_COND_MSG(!success, "Renaming child in hashtable failed, this is a bug.");
+		data.parent->_release_child_name(old_name);
 	}
 
 	if (data.unique_name_in_owner && data.owner) {
@@ -1443,6 +1444,15 @@ String increase_numeric_string(const String &s) {
 	return res;
 }
 
+// Returns the number of a child name suffix, or -1 if it can't be used to skip taken names
+// (leading zeros are kept when increasing, so those don't follow the usual sequence).
+static int64_t _get_child_name_serial(const String &p_nums) {
+	if (p_nums.is_empty() || p_nums.length() > 15 || p_nums[0] == '0') {
+		return -1;
+	}
+	return p_nums.to_int();
+}
+
 void Node::_generate_serial_child_name(const Node *p_child, StringName &name) const {
 	if (name == StringName()) {
 		// No name and a new name is needed, create one.
@@ -1477,6 +1487,41 @@ void Node::_generate_serial_child_name(const Node *p_child, StringName &name) co
 		nums = "";
 	}
 
+	if (nums.length() == 0) {
+		existing = data.children.getptr(name_string);
+		if (existing == nullptr || *existing == p_child) {
+			name = name_string;
+			return;
+		}
+		// Name was undecorated so skip to 2 for a more natural result
+		nums = "2";
+		name_string += nnsep; // Add separator because nums.length() > 0 was false
+	}
+
+	// The requested number is kept if it's free, or if it's the current name of the child.
+	existing = data.children.getptr(name_string + nums);
+	if (existing == nullptr || *existing == p_child) {
+		name = name_string + nums;
+		return;
+	}
+
+	// Skip the numbers known to be taken, so adding many children with the same name
+	// doesn't probe all the previous ones again. A renamed child is already in the list,
+	// and one of the skipped numbers may be its current name, so it probes them as before.
+	int64_t *first_free = nullptr;
+	const int64_t serial = _get_child_name_serial(nums);
+	if (serial >= 2 && p_child->data.parent != this) {
+		first_free = data.child_name_serials.getptr(name_string);
+		if (!first_free) {
+			first_free = &data.child_name_serials.insert(name_string, 2)->value;
+		}
+		if (serial <= *first_free) {
+			nums = itos(*first_free);
+		} else {
+			first_free = nullptr; // Can't tell whether the numbers in between are taken.
+		}
+	}
+
 	for (;;) {
 		StringName attempt = name_string + nums;
 
@@ -1484,25 +1529,48 @@ void Node::_generate_serial_child_name(const Node *p_child, StringName &name) co
 		bool exists = existing != nullptr && *existing != p_child;
 
 		if (!exists) {
+			if (first_free) {
+				*first_free = nums.to_int();
+			}
 			name = attempt;
 			return;
 		} else {
-			if (nums.length() == 0) {
-				// Name was undecorated so skip to 2 for a more natural result
-				nums = "2";
-				name_string += nnsep; // Add separator because nums.length() > 0 was false
-			} else {
-				nums = increase_numeric_string(nums);
-			}
+			nums = increase_numeric_string(nums);
 		}
 	}
 }
 
+void Node::_release_child_name(const StringName &p_name) {
+	if (data.child_name_serials.is_empty()) {
+		return;
+	}
+	if (data.children.is_empty()) {
+		data.child_name_serials.clear();
+		return;
+	}
+
+	// If a numbered name was freed, lower the first number that may be free for its base.
+	String name_string = p_name;
+	int nums_begin = name_string.length();
+	while (nums_begin > 0 && is_digit(name_string[nums_begin - 1])) {
+		nums_begin--;
+	}
+	const int64_t serial = _get_child_name_serial(name_string.substr(nums_begin));
+	if (serial < 2) {
+		return;
+	}
+
+	int64_t *first_free = data.child_name_serials.getptr(name_string.substr(0, nums_begin));
+	if (first_free && serial < *first_free) {
+		*first_free = serial;
+	}
+}
+
 Node::InternalMode Node::get_internal_mode() const {
 	return data.internal_mode;
 }
 
-void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalMode p_internal_mode) {
+void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalMode p_internal_mode, bool p_notify_order_changed) {
 	//add a child node quickly, without name validation
 
 	p_child->data.name = p_name;
@@ -1540,8 +1608,10 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalM
 	//recognize children created in this node constructor
 	p_child->data.parent_owned = data.in_constructor;
 	add_child_notify(p_child);
-	notification(NOTIFICATION_CHILD_ORDER_CHANGED);
-	emit_signal(SNAME("child_order_changed"));
+	if (p_notify_order_changed) {
+		notification(NOTIFICATION_CHILD_ORDER_CHANGED);
+		emit_signal(SNAME("child_order_changed"));
+	}
 }
 
 void Node::add_child(Node *p_child, bool p_force_readable_name, InternalMode p_internal) {
@@ -1578,6 +1648,17 @@ void Node::remove_child(Node *p_child) {
 	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy adding/removing children, `remove_child()` can't be called at this time. Consider using `remove_child.call_deferred(child)` instead.");
 	ERR_FAIL_COND(p_child->data.parent != this);
 
+	_remove_child_nocheck(p_child);
+
+	notification(NOTIFICATION_CHILD_ORDER_CHANGED);
+	emit_signal(SNAME("child_order_changed"));
+
+	if (data.inside_tree) {
+		p_child->_propagate_after_exit_tree();
+	}
+}
+
+void Node::_remove_child_nocheck(Node *p_child) {
 	/**
 	 *  Do not change the data.internal_children*cache counters here.
 	 *  Because if nodes are re-added, the indices can remain
@@ -1600,15 +1681,112 @@ void Node::remove_child(Node *p_child) {
 	data.children_cache_dirty = true;
 	bool success = data.children.erase(p_child->data.name);
 	ERR_FAIL_COND_MSG(!success, "Children name does not match parent name in hashtable, this is a bug.");
+	_release_child_name(p_child->data.name);
 
 	p_child->data.parent = nullptr;
 	p_child->data.index = -1;
+}
+
+void Node::add_children(const TypedArray<Node> &p_children, bool p_force_readable_name, InternalMode p_internal) {
+	ERR_FAIL_COND_MSG(data.inside_tree && !Thread::is_main_thread(), "Adding children to a node inside the SceneTree is only allowed from the main thread. Use call_deferred(\"add_children\",nodes).");
+
+	ERR_THREAD_GUARD
+	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy setting up children, `add_children()` failed. Consider using `add_children.call_deferred(children)` instead.");
+
+	// Group and process list updates of the whole batch are applied together, and the
+	// child order change is notified once.
+	SceneTree *tree = data.tree;
+	if (tree) {
+		tree->_begin_node_batch();
+	}
+
+	bool added = false;
+	for (int i = 0; i < p_children.size(); i++) {
+		Node *child = Object::cast_to<Node>(p_children[i]);
+		ERR_CONTINUE(!child);
+		ERR_CONTINUE_MSG(child == this, vformat("Can't add child '%s' to itself.", child->get_name()));
+		ERR_CONTINUE_MSG(child->data.parent, vformat("Can't add child '%s' to '%s', already has a parent '%s'.", child->get_name(), get_name(), child->data.parent->get_name()));
+#ifdef DEBUG_ENABLED
+		ERR_CONTINUE_MSG(child->is_ancestor_of(this), vformat("Can't add child '%s' to '%s' as it would result in a cyclic dependency since '%s' is already a parent of '%s'.", child->get_name(), get_name(), child->get_name(), get_name()));
+#endif
+
+		_validate_child_name(child, p_force_readable_name);
+		_add_child_nocheck(child, child->data.name, p_internal, false);
+		added = true;
+	}
+
+	if (tree) {
+		tree->_end_node_batch();
+	}
+
+	if (added) {
+		notification(NOTIFICATION_CHILD_ORDER_CHANGED);
+		emit_signal(SNAME("child_order_changed"));
+	}
+}
+
+void Node::remove_children(const TypedArray<Node> &p_children) {
+	ERR_FAIL_COND_MSG(data.inside_tree && !Thread::is_main_thread(), "Removing children from a node inside the SceneTree is only allowed from the main thread. Use call_deferred(\"remove_children\",nodes).");
+	ERR_FAIL_COND_MSG(data.blocked > 0, "Parent node is busy adding/removing children, `remove_children()` can't be called at this time. Consider using `remove_children.call_deferred(children)` instead.");
+
+	// Group and process list removals of the whole batch are applied in one pass per list,
+	// instead of searching each list for every node.
+	SceneTree *tree = data.tree;
+	if (tree) {
+		tree->_begin_node_batch();
+	}
+
+	LocalVector<Node *> removed;
+	removed.reserve(p_children.size());
+	for (int i = 0; i < p_children.size(); i++) {
+		Node *child = Object::cast_to<Node>(p_children[i]);
+		ERR_CONTINUE(!child);
+		ERR_CONTINUE_MSG(child->data.parent != this, vformat("Can't remove child '%s' from '%s', it's not a child of it.", child->get_name(), get_name()));
+
+		_remove_child_nocheck(child);
+		removed.push_back(child);
+	}
+
+	if (tree) {
+		tree->_end_node_batch();
+	}
+
+	if (removed.is_empty()) {
+		return;
+	}
 
 	notification(NOTIFICATION_CHILD_ORDER_CHANGED);
 	emit_signal(SNAME("child_order_changed"));
 
 	if (data.inside_tree) {
-		p_child->_propagate_after_exit_tree();
+		for (Node *child : removed) {
+			child->_propagate_after_exit_tree();
+		}
+	}
+}
+
+void Node::free_children(const TypedArray<Node> &p_children) {
+	ERR_FAIL_COND_MSG(data.inside_tree && !Thread::is_main_thread(), "Freeing children of a node inside the SceneTree is only allowed from the main thread. Use call_deferred(\"free_children\",nodes).");
+
+	// Signals emitted while removing may free some of them already.
+	LocalVector<ObjectID> ids;
+	ids.reserve(p_children.size());
+	for (int i = 0; i < p_children.size(); i++) {
+		Node *child = Object::cast_to<Node>(p_children[i]);
+		if (child && child->data.parent == this) {
+			ids.push_back(child->get_instance_id());
+		}
+	}
+
+	remove_children(p_children);
+
+	// Out of the tree, so freeing their subtrees doesn't touch groups or process lists anymore.
+	// Nodes that were added to another parent by a signal emitted while removing are kept.
+	for (const ObjectID &id : ids) {
+		Node *child = Object::cast_to<Node>(ObjectDB::get_instance(id));
+		if (child && child->data.parent == nullptr) {
+			memdelete(child);
+		}
 	}
 }
 
@@ -2245,17 +2423,13 @@ void Node::add_to_group(const StringName &p_identifier, bool p_persistent) {
 		return;
 	}
 
-	GroupData gd;
+	GroupData &gd = data.grouped[p_identifier];
+	gd.persistent = p_persistent;
 
 	if (data.tree) {
+		// Needs the group data inserted already, the tree keeps the node's index in it.
 		gd.group = data.tree->add_to_group(p_identifier, this);
-	} else {
-		gd.group = nullptr;
 	}
-
-	gd.persistent = p_persistent;
-
-	data.grouped[p_identifier] = gd;
 }
 
 void Node::remove_from_group(const StringName &p_identifier) {
@@ -3428,6 +3602,9 @@ void Node::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_name"), &Node::get_name);
 	ClassDB::bind_method(D_METHOD("add_child", "node", "force_readable_name", "internal"), &Node::add_child, DEFVAL(false), DEFVAL(0));
 	ClassDB::bind_method(D_METHOD("remove_child", "node"), &Node::remove_child);
+	ClassDB::bind_method(D_METHOD("add_children", "nodes", "force_readable_name", "internal"), &Node::add_children, DEFVAL(false), DEFVAL(0));
+	ClassDB::bind_method(D_METHOD("remove_children", "nodes"), &Node::remove_children);
+	ClassDB::bind_method(D_METHOD("free_children", "nodes"), &Node::free_children);
 	ClassDB::bind_method(D_METHOD("reparent", "new_parent", "keep_global_transform"), &Node::reparent, DEFVAL(true));
 	ClassDB::bind_method(D_METHOD("get_child_count", "include_internal"), &Node::get_child_count, DEFVAL(false)); // Note that the default value bound for include_internal is false, while the method is declared with true. This is because internal nodes are irrelevant for GDSCript.
 	ClassDB::bind_method(D_METHOD("get_children", "include_internal"), &Node::get_children, DEFVAL(false));
@@ -43,10 +43,14 @@
 #include "core/os/os.h"
 #include "core/string/print_string.h"
 #include "node.h"
+#ifndef _3D_DISABLED
+#include "scene/3d/visual_instance_3d.h"
+#endif // _3D_DISABLED
 #include "scene/animation/tween.h"
 #include "scene/debugger/scene_debugger.h"
 #include "scene/gui/control.h"
 #include "scene/main/multiplayer_api.h"
+#include "scene/main/timer.h"
 #include "scene/main/viewport.h"
 #include "scene/resources/environment.h"
 #include "scene/resources/font.h"
@@ -74,16 +78,38 @@ void SceneTreeTimer::_bind_methods() {
 	ADD_SIGNAL(MethodInfo("timeout"));
 }
 
+void SceneTreeTimer::_reschedule() {
+	SceneTree::get_singleton()->_schedule_timer(&wheel_item, process_in_physics, ignore_time_scale ? SceneTree::TIMER_CLOCK_UNSCALED : SceneTree::TIMER_CLOCK_SCALED, process_always, time_left);
+}
+
 void SceneTreeTimer::set_time_left(double p_time) {
+	MutexLock lock(SceneTree::timer_mutex);
 	time_left = p_time;
+	if (wheel_item.wheel) {
+		wheel_item.wheel->remove(&wheel_item);
+		_reschedule();
+	} else if (wheel_item.expired) {
+		// Expired this frame but the timeout wasn't emitted yet, scheduling it again cancels it.
+		_reschedule();
+	}
 }
 
 double SceneTreeTimer::get_time_left() const {
-	return MAX(time_left, 0.0);
+	MutexLock lock(SceneTree::timer_mutex);
+	if (wheel_item.wheel) {
+		return MAX(wheel_item.get_time_left(), 0.0);
+	}
+	return wheel_item.expired ? 0.0 : MAX(time_left, 0.0);
 }
 
 void SceneTreeTimer::set_process_always(bool p_process_always) {
+	MutexLock lock(SceneTree::timer_mutex);
 	process_always = p_process_always;
+	if (wheel_item.wheel) {
+		time_left = wheel_item.get_time_left();
+		wheel_item.wheel->remove(&wheel_item);
+		_reschedule();
+	}
 }
 
 bool SceneTreeTimer::is_process_always() {
@@ -91,7 +117,13 @@ bool SceneTreeTimer::is_process_always() {
 }
 
 void SceneTreeTimer::set_process_in_physics(bool p_process_in_physics) {
+	MutexLock lock(SceneTree::timer_mutex);
 	process_in_physics = p_process_in_physics;
+	if (wheel_item.wheel) {
+		time_left = wheel_item.get_time_left();
+		wheel_item.wheel->remove(&wheel_item);
+		_reschedule();
+	}
 }
 
 bool SceneTreeTimer::is_process_in_physics() {
@@ -99,7 +131,13 @@ bool SceneTreeTimer::is_process_in_physics() {
 }
 
 void SceneTreeTimer::set_ignore_time_scale(bool p_ignore) {
+	MutexLock lock(SceneTree::timer_mutex);
 	ignore_time_scale = p_ignore;
+	if (wheel_item.wheel) {
+		time_left = wheel_item.get_time_left();
+		wheel_item.wheel->remove(&wheel_item);
+		_reschedule();
+	}
 }
 
 bool SceneTreeTimer::is_ignore_time_scale() {
@@ -115,7 +153,10 @@ void SceneTreeTimer::release_connections() {
 	}
 }
 
-SceneTreeTimer::SceneTreeTimer() {}
+SceneTreeTimer::SceneTreeTimer() {
+	wheel_item.owner = get_instance_id();
+	wheel_item.exclusive = false;
+}
 
 void SceneTree::tree_changed() {
 	tree_version++;
@@ -144,16 +185,20 @@ void SceneTree::node_renamed(Node *p_node) {
 SceneTree::Group *SceneTree::add_to_group(const StringName &p_group, Node *p_node) {
 	_THREAD_SAFE_METHOD_
 
+	Node::GroupData *gd = p_node->data.grouped.getptr(p_group);
+	ERR_FAIL_NULL_V(gd, nullptr);
+
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	if (!E) {
 		E = group_map.insert(p_group, Group());
 	}
 
-	ERR_FAIL_COND_V_MSG(E->value.nodes.has(p_node), &E->value, "Already in group: " + p_group + ".");
-	E->value.nodes.push_back(p_node);
-	//E->value.last_tree_version=0;
-	E->value.changed = true;
-	return &E->value;
+	Group &g = E->value;
+	ERR_FAIL_COND_V_MSG(gd->index >= 0 && gd->index < g.nodes.size() && g.nodes[gd->index] == p_node, &g, "Already in group: " + p_group + ".");
+	gd->index = g.nodes.size();
+	g.nodes.push_back(p_node);
+	g.changed = true;
+	return &g;
 }
 
 void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
@@ -161,13 +206,65 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
 	ERR_FAIL_COND(!E);
+	Node::GroupData *gd = p_node->data.grouped.getptr(p_group);
+	ERR_FAIL_NULL(gd);
 
-	E->value.nodes.erase(p_node);
-	if (E->value.nodes.is_empty()) {
+	Group &g = E->value;
+	const int index = gd->index;
+	ERR_FAIL_COND(index < 0 || index >= g.nodes.size() || g.nodes[index] != p_node);
+
+	// Move the last node into the free slot, the order is restored when it's needed.
+	const int last = g.nodes.size() - 1;
+	if (index != last) {
+		Node *moved = g.nodes[last];
+		g.nodes.write[index] = moved;
+		moved->data.grouped.getptr(p_group)->index = index;
+		g.changed = true;
+	}
+	g.nodes.resize(last);
+	gd->index = -1;
+
+	if (g.nodes.is_empty()) {
 		group_map.remove(E);
 	}
 }
 
+// Removes the nodes in p_removed from p_nodes, keeping the order of the others.
+static void _erase_batched_nodes(Vector<Node *> &p_nodes, const HashSet<Node *> &p_removed) {
+	if (p_removed.is_empty()) {
+		return;
+	}
+	Node **ptr = p_nodes.ptrw();
+	int count = p_nodes.size();
+	int kept = 0;
+	for (int i = 0; i < count; i++) {
+		if (!p_removed.has(ptr[i])) {
+			ptr[kept++] = ptr[i];
+		}
+	}
+	p_nodes.resize(kept);
+}
+
+void SceneTree::_begin_node_batch() {
+	_THREAD_SAFE_METHOD_
+	node_batch_lock++;
+}
+
+void SceneTree::_end_node_batch() {
+	_THREAD_SAFE_METHOD_
+	ERR_FAIL_COND(node_batch_lock == 0);
+	node_batch_lock--;
+	if (node_batch_lock) {
+		return;
+	}
+
+	for (KeyValue<ProcessGroup *, BatchedProcessRemovals> &R : batched_process_removals) {
+		_erase_batched_nodes(R.key->nodes, R.value.nodes);
+		_erase_batched_nodes(R.key->physics_nodes, R.value.physics_nodes);
+	}
+	batched_process_removals.clear();
+}
+
 void SceneTree::make_group_changed(const StringName &p_group) {
 	_THREAD_SAFE_METHOD_
 	HashMap<StringName, Group>::Iterator E = group_map.find(p_group);
@@ -179,6 +276,13 @@ void SceneTree::make_group_changed(const StringName &p_group) {
 void SceneTree::flush_transform_notifications() {
 	_THREAD_SAFE_METHOD_
 
+#ifndef _3D_DISABLED
+	if (parallel_transform_resolve) {
+		// Compute the global transforms in bulk so the notifications below find them up to date.
+		Node3D::resolve_global_transforms(xform_change_list);
+	}
+#endif // _3D_DISABLED
+
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
 		Node *node = n->self();
@@ -209,7 +313,7 @@ void SceneTree::_flush_ugc() {
 	ugc_locked = false;
 }
 
-void SceneTree::_update_group_order(Group &g) {
+void SceneTree::_update_group_order(const StringName &p_group, Group &g) {
 	if (!g.changed) {
 		return;
 	}
@@ -223,6 +327,10 @@ void SceneTree::_update_group_order(Group &g) {
 	SortArray<Node *, Node::Comparator> node_sort;
 	node_sort.sort(gr_nodes, gr_node_count);
 
+	for (int i = 0; i < gr_node_count; i++) {
+		gr_nodes[i]->data.grouped.getptr(p_group)->index = i;
+	}
+
 	g.changed = false;
 }
 
@@ -261,7 +369,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 			return;
 		}
 
-		_update_group_order(g);
+		_update_group_order(p_group, g);
 		nodes_copy = g.nodes;
 	}
 
@@ -324,7 +432,7 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 			return;
 		}
 
-		_update_group_order(g);
+		_update_group_order(p_group, g);
 
 		nodes_copy = g.nodes;
 	}
@@ -387,7 +495,7 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 			return;
 		}
 
-		_update_group_order(g);
+		_update_group_order(p_group, g);
 
 		nodes_copy = g.nodes;
 	}
@@ -527,6 +635,11 @@ bool SceneTree::process(double p_time) {
 
 	_call_idle_callbacks();
 
+#ifndef _3D_DISABLED
+	// Send all the instance transforms that changed this frame in a single call.
+	VisualInstance3D::flush_transform_updates();
+#endif // _3D_DISABLED
+
 #ifdef TOOLS_ENABLED
 #ifndef _3D_DISABLED
 	if (Engine::get_singleton()->is_editor_hint()) {
@@ -557,36 +670,67 @@ bool SceneTree::process(double p_time) {
 	return _quit;
 }
 
-void SceneTree::process_timers(double p_delta, bool p_physics_frame) {
-	_THREAD_SAFE_METHOD_
-	List<Ref<SceneTreeTimer>>::Element *L = timers.back(); //last element
+void SceneTree::_schedule_timer(TimerWheel::Item *p_item, bool p_physics, TimerClock p_clock, bool p_process_always, double p_time_left) {
+	MutexLock lock(timer_mutex);
+	p_item->order = timer_order++;
+	timer_wheels[p_physics ? 1 : 0][p_clock][p_process_always ? 1 : 0].insert(p_item, p_time_left);
+}
 
-	for (List<Ref<SceneTreeTimer>>::Element *E = timers.front(); E;) {
-		List<Ref<SceneTreeTimer>>::Element *N = E->next();
-		if ((paused && !E->get()->is_process_always()) || (E->get()->is_process_in_physics() != p_physics_frame)) {
-			if (E == L) {
-				break; //break on last, so if new timers were added during list traversal, ignore them.
+void SceneTree::process_timers(double p_delta, bool p_physics_frame) {
+	double clock_delta[TIMER_CLOCK_MAX];
+	clock_delta[TIMER_CLOCK_SCALED] = p_delta;
+	clock_delta[TIMER_CLOCK_UNSCALED] = Engine::get_singleton()->get_process_step();
+	const double time_scale = Engine::get_singleton()->get_time_scale();
+	clock_delta[TIMER_CLOCK_NODE_UNSCALED] = time_scale > 0.0 ? p_delta / time_scale : 0.0;
+
+	// Timeouts can free Timer nodes or restart timers which expired at the same time,
+	// so refer to them by ID and check they are still expired before emitting.
+	LocalVector<ObjectID> expired_ids;
+	{
+		MutexLock lock(timer_mutex);
+
+		// Only timers that are due are visited, the wheels don't iterate pending ones.
+		LocalVector<TimerWheel::Item *> expired;
+		for (int i = 0; i < TIMER_CLOCK_MAX; i++) {
+			TimerWheel *wheels = timer_wheels[p_physics_frame ? 1 : 0][i];
+			wheels[1].advance(clock_delta[i], expired);
+			if (!paused) {
+				wheels[0].advance(clock_delta[i], expired);
 			}
-			E = N;
-			continue;
 		}
 
-		double time_left = E->get()->get_time_left();
-		if (E->get()->is_ignore_time_scale()) {
-			time_left -= Engine::get_singleton()->get_process_step();
-		} else {
-			time_left -= p_delta;
+		if (expired.is_empty()) {
+			return;
 		}
-		E->get()->set_time_left(time_left);
 
-		if (time_left <= 0) {
-			E->get()->emit_signal(SNAME("timeout"));
-			timers.erase(E);
+		// Emit in scheduling order, like the timers would have been processed in a list.
+		expired.sort_custom<TimerWheel::ItemOrderComparator>();
+
+		expired_ids.resize(expired.size());
+		for (uint32_t i = 0; i < expired.size(); i++) {
+			expired_ids[i] = expired[i]->owner;
 		}
-		if (E == L) {
-			break; //break on last, so if new timers were added during list traversal, ignore them.
+	}
+
+	// The signals are emitted without holding the lock, handlers may wait on threads that use timers.
+	for (const ObjectID &id : expired_ids) {
+		Object *obj = ObjectDB::get_instance(id);
+		if (SceneTreeTimer *stt = Object::cast_to<SceneTreeTimer>(obj)) {
+			{
+				MutexLock lock(timer_mutex);
+				if (!stt->wheel_item.expired) {
+					continue;
+				}
+				stt->wheel_item.expired = false;
+				stt->time_left = stt->wheel_item.expired_time_left;
+			}
+
+			Ref<SceneTreeTimer> ref = stt;
+			stt->unreference(); // Drop the reference held while it was scheduled.
+			stt->emit_signal(SNAME("timeout"));
+		} else if (Timer *timer = Object::cast_to<Timer>(obj)) {
+			timer->_timeout();
 		}
-		E = N;
 	}
 }
 
@@ -636,10 +780,25 @@ void SceneTree::finalize() {
 	MainLoop::finalize();
 
 	// Cleanup timers.
-	for (Ref<SceneTreeTimer> &timer : timers) {
-		timer->release_connections();
+	LocalVector<TimerWheel::Item *> scheduled;
+	timer_mutex.lock();
+	for (int i = 0; i < 2; i++) {
+		for (int j = 0; j < TIMER_CLOCK_MAX; j++) {
+			for (int k = 0; k < 2; k++) {
+				timer_wheels[i][j][k].clear(&scheduled);
+			}
+		}
+	}
+	timer_mutex.unlock();
+	for (TimerWheel::Item *item : scheduled) {
+		SceneTreeTimer *stt = Object::cast_to<SceneTreeTimer>(ObjectDB::get_instance(item->owner));
+		if (stt) {
+			stt->release_connections();
+			if (stt->unreference()) {
+				memdelete(stt);
+			}
+		}
 	}
-	timers.clear();
 
 	// Cleanup tweens.
 	for (Ref<Tween> &tween : tweens) {
@@ -1128,6 +1287,20 @@ void SceneTree::_remove_node_from_process_group(Node *p_node, Node *p_owner) {
 	_THREAD_SAFE_METHOD_
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
+	if (node_batch_lock) {
+		HashMap<ProcessGroup *, BatchedProcessRemovals>::Iterator R = batched_process_removals.find(pg);
+		if (!R) {
+			R = batched_process_removals.insert(pg, BatchedProcessRemovals());
+		}
+		if (p_node->is_processing() || p_node->is_processing_internal()) {
+			R->value.nodes.insert(p_node);
+		}
+		if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
+			R->value.physics_nodes.insert(p_node);
+		}
+		return;
+	}
+
 	if (p_node->is_processing() || p_node->is_processing_internal()) {
 		bool found = pg->nodes.erase(p_node);
 		ERR_FAIL_COND(!found);
@@ -1143,13 +1316,20 @@ void SceneTree::_add_node_to_process_group(Node *p_node, Node *p_owner) {
 	_THREAD_SAFE_METHOD_
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
+	BatchedProcessRemovals *removed = node_batch_lock ? batched_process_removals.getptr(pg) : nullptr;
+
 	if (p_node->is_processing() || p_node->is_processing_internal()) {
-		pg->nodes.push_back(p_node);
+		// Unless it was removed earlier in the batch, then it's still in the list.
+		if (!removed || !removed->nodes.erase(p_node)) {
+			pg->nodes.push_back(p_node);
+		}
 		pg->node_order_dirty = true;
 	}
 
 	if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
-		pg->physics_nodes.push_back(p_node);
+		if (!removed || !removed->physics_nodes.erase(p_node)) {
+			pg->physics_nodes.push_back(p_node);
+		}
 		pg->physics_node_order_dirty = true;
 	}
 }
@@ -1168,7 +1348,7 @@ void SceneTree::_call_input_pause(const StringName &p_group, CallInputType p_cal
 			return;
 		}
 
-		_update_group_order(g);
+		_update_group_order(p_group, g);
 
 		//copy, so copy on write happens in case something is removed from process while being called
 		//performance is not lost because only if something is added/removed the vector is copied.
@@ -1287,7 +1467,7 @@ TypedArray<Node> SceneTree::_get_nodes_in_group(const StringName &p_group) {
 		return ret;
 	}
 
-	_update_group_order(E->value); //update order just in case
+	_update_group_order(E->key, E->value); //update order just in case
 	int nc = E->value.nodes.size();
 	if (nc == 0) {
 		return ret;
@@ -1315,7 +1495,7 @@ Node *SceneTree::get_first_node_in_group(const StringName &p_group) {
 		return nullptr; // No group.
 	}
 
-	_update_group_order(E->value); // Update order just in case.
+	_update_group_order(E->key, E->value); // Update order just in case.
 
 	if (E->value.nodes.is_empty()) {
 		return nullptr;
@@ -1331,7 +1511,7 @@ void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_li
 		return;
 	}
 
-	_update_group_order(E->value); //update order just in case
+	_update_group_order(E->key, E->value); //update order just in case
 	int nc = E->value.nodes.size();
 	if (nc == 0) {
 		return;
@@ -1342,6 +1522,100 @@ void SceneTree::get_nodes_in_group(const StringName &p_group, List<Node *> *p_li
 	}
 }
 
+int SceneTree::get_node_count_in_group(const StringName &p_group) const {
+	_THREAD_SAFE_METHOD_
+	const Group *group = group_map.getptr(p_group);
+	return group ? group->nodes.size() : 0;
+}
+
+void SceneTree::get_nodes_in_groups(const Vector<StringName> &p_groups, GroupQuery p_query, LocalVector<Node *> &r_nodes, bool p_tree_order) {
+	_THREAD_SAFE_METHOD_
+	r_nodes.clear();
+
+	// Membership in the other groups is checked on each node, without sets or sorting.
+	switch (p_query) {
+		case GROUP_QUERY_ALL: {
+			int smallest = -1;
+			for (int i = 0; i < p_groups.size(); i++) {
+				const Group *group = group_map.getptr(p_groups[i]);
+				if (!group) {
+					return; // Nothing is in every group.
+				}
+				if (smallest == -1 || group->nodes.size() < group_map[p_groups[smallest]].nodes.size()) {
+					smallest = i;
+				}
+			}
+			if (smallest == -1) {
+				return;
+			}
+
+			Group &base = group_map[p_groups[smallest]];
+			if (p_tree_order) {
+				_update_group_order(p_groups[smallest], base); // The result follows its order.
+			}
+
+			r_nodes.reserve(base.nodes.size());
+			for (Node *node : base.nodes) {
+				bool in_all = true;
+				for (int i = 0; i < p_groups.size(); i++) {
+					if (i != smallest && !node->data.grouped.has(p_groups[i])) {
+						in_all = false;
+						break;
+					}
+				}
+				if (in_all) {
+					r_nodes.push_back(node);
+				}
+			}
+		} break;
+
+		case GROUP_QUERY_ANY: {
+			for (int i = 0; i < p_groups.size(); i++) {
+				const Group *group = group_map.getptr(p_groups[i]);
+				if (!group) {
+					continue;
+				}
+				for (Node *node : group->nodes) {
+					// Skip the nodes already added from a previous group.
+					bool seen = false;
+					for (int j = 0; j < i; j++) {
+						if (node->data.grouped.has(p_groups[j])) {
+							seen = true;
+							break;
+						}
+					}
+					if (!seen) {
+						r_nodes.push_back(node);
+					}
+				}
+			}
+
+			if (p_tree_order) {
+				r_nodes.sort_custom<Node::Comparator>();
+			}
+		} break;
+	}
+}
+
+PackedInt64Array SceneTree::_get_node_ids_in_groups(const TypedArray<StringName> &p_groups, GroupQuery p_query, bool p_tree_order) {
+	Vector<StringName> groups;
+	groups.resize(p_groups.size());
+	for (int i = 0; i < p_groups.size(); i++) {
+		groups.write[i] = p_groups[i];
+	}
+
+	LocalVector<Node *> nodes;
+	get_nodes_in_groups(groups, p_query, nodes, p_tree_order);
+
+	PackedInt64Array ids;
+	ids.resize(nodes.size());
+	int64_t *ptr = ids.ptrw();
+	for (uint32_t i = 0; i < nodes.size(); i++) {
+		ptr[i] = nodes[i]->get_instance_id();
+	}
+	return ids;
+}
+
 void SceneTree::_flush_delete_queue() {
 	_THREAD_SAFE_METHOD_
 
@@ -1465,7 +1739,8 @@ Ref<SceneTreeTimer> SceneTree::create_timer(double p_delay_sec, bool p_process_a
 	stt->set_time_left(p_delay_sec);
 	stt->set_process_in_physics(p_process_in_physics);
 	stt->set_ignore_time_scale(p_ignore_time_scale);
-	timers.push_back(stt);
+	stt->reference(); // Held while scheduled, released after emitting the timeout.
+	_schedule_timer(&stt->wheel_item, p_process_in_physics, p_ignore_time_scale ? TIMER_CLOCK_UNSCALED : TIMER_CLOCK_SCALED, p_process_always, p_delay_sec);
 	return stt;
 }
 
@@ -1624,6 +1899,8 @@ void SceneTree::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("get_nodes_in_group", "group"), &SceneTree::_get_nodes_in_group);
 	ClassDB::bind_method(D_METHOD("get_first_node_in_group", "group"), &SceneTree::get_first_node_in_group);
+	ClassDB::bind_method(D_METHOD("get_node_count_in_group", "group"), &SceneTree::get_node_count_in_group);
+	ClassDB::bind_method(D_METHOD("get_node_ids_in_groups", "groups", "query", "tree_order"), &SceneTree::_get_node_ids_in_groups, DEFVAL(false));
 
 	ClassDB::bind_method(D_METHOD("set_current_scene", "child_node"), &SceneTree::set_current_scene);
 	ClassDB::bind_method(D_METHOD("get_current_scene"), &SceneTree::get_current_scene);
@@ -1671,9 +1948,13 @@ void SceneTree::_bind_methods() {
 	BIND_ENUM_CONSTANT(GROUP_CALL_REVERSE);
 	BIND_ENUM_CONSTANT(GROUP_CALL_DEFERRED);
 	BIND_ENUM_CONSTANT(GROUP_CALL_UNIQUE);
+
+	BIND_ENUM_CONSTANT(GROUP_QUERY_ALL);
+	BIND_ENUM_CONSTANT(GROUP_QUERY_ANY);
 }
 
 SceneTree *SceneTree::singleton = nullptr;
+Mutex SceneTree::timer_mutex;
 
 SceneTree::IdleCallback SceneTree::idle_callbacks[SceneTree::MAX_IDLE_CALLBACKS];
 int SceneTree::idle_callback_count = 0;
@@ -1875,6 +2156,11 @@ SceneTree::SceneTree() {
 
 	GLOBAL_DEF("debug/shapes/collision/draw_2d_outlines", true);
 
+	parallel_transform_resolve = GLOBAL_DEF("application/run/parallel_transform_resolve", false);
+#ifndef _3D_DISABLED
+	VisualInstance3D::set_batch_transform_updates(GLOBAL_DEF("application/run/batch_instance_transform_updates", false));
+#endif // _3D_DISABLED
+
 	process_group_call_queue_allocator = memnew(CallQueue::Allocator(64));
 	Math::randomize();
 }
@@ -35,6 +35,7 @@
 #include "core/os/thread_safe.h"
 #include "core/templates/paged_allocator.h"
 #include "core/templates/self_list.h"
+#include "scene/main/timer_wheel.h"
 #include "scene/resources/mesh.h"
 
 #undef Window
@@ -57,6 +58,11 @@ class SceneTreeTimer : public RefCounted {
 	bool process_in_physics = false;
 	bool ignore_time_scale = false;
 
+	friend class SceneTree;
+	TimerWheel::Item wheel_item;
+
+	void _reschedule();
+
 protected:
 	static void _bind_methods();
 
@@ -116,6 +122,8 @@ private:
 	bool node_threading_disabled = false;
 
 	struct Group {
+		// Each node stores its index here, removed nodes are replaced by the last one.
+		// Sorted by tree order only when ordered iteration is requested.
 		Vector<Node *> nodes;
 		bool changed = false;
 	};
@@ -168,13 +176,26 @@ private:
 	int nodes_removed_on_group_call_lock = 0;
 	HashSet<Node *> nodes_removed_on_group_call; // Skip erased nodes.
 
+	// While adding or removing children in bulk, removals from process lists are collected
+	// and then applied in a single pass per list (see Node::remove_children()).
+	struct BatchedProcessRemovals {
+		HashSet<Node *> nodes;
+		HashSet<Node *> physics_nodes;
+	};
+
+	int node_batch_lock = 0;
+	HashMap<ProcessGroup *, BatchedProcessRemovals> batched_process_removals;
+
+	void _begin_node_batch();
+	void _end_node_batch();
+
 	List<ObjectID> delete_queue;
 
 	HashMap<UGCall, Vector<Variant>, UGCall> unique_group_calls;
 	bool ugc_locked = false;
 	void _flush_ugc();
 
-	_FORCE_INLINE_ void _update_group_order(Group &g);
+	_FORCE_INLINE_ void _update_group_order(const StringName &p_group, Group &g);
 
 	TypedArray<Node> _get_nodes_in_group(const StringName &p_group);
 
@@ -193,7 +214,25 @@ private:
 
 	void _flush_scene_change();
 
-	List<Ref<SceneTreeTimer>> timers;
+	enum TimerClock {
+		TIMER_CLOCK_SCALED, // Process delta.
+		TIMER_CLOCK_UNSCALED, // Engine process step, for SceneTreeTimers ignoring the time scale.
+		TIMER_CLOCK_NODE_UNSCALED, // Process delta divided by the time scale, for Timer nodes ignoring it.
+		TIMER_CLOCK_MAX,
+	};
+
+	// SceneTreeTimers and running Timer nodes, indexed by [physics][clock][process always].
+	// Timer nodes only stay scheduled while they can process, so they always use the last index.
+	// Timers can be started, stopped and changed from threaded processing groups, so the wheels and
+	// the scheduling state of their items are only accessed with timer_mutex held.
+	static Mutex timer_mutex;
+	TimerWheel timer_wheels[2][TIMER_CLOCK_MAX][2];
+	uint64_t timer_order = 0;
+
+	friend class SceneTreeTimer;
+	friend class Timer;
+	void _schedule_timer(TimerWheel::Item *p_item, bool p_physics, TimerClock p_clock, bool p_process_always, double p_time_left);
+
 	List<Ref<Tween>> tweens;
 
 	///network///
@@ -235,6 +274,8 @@ private:
 	friend class Viewport;
 
 	SelfList<Node>::List xform_change_list;
+	bool parallel_transform_resolve = false;
+	friend class TestNode3DAccessor;
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -278,6 +319,11 @@ public:
 		GROUP_CALL_UNIQUE = 4,
 	};
 
+	enum GroupQuery {
+		GROUP_QUERY_ALL, // Nodes in every group.
+		GROUP_QUERY_ANY, // Nodes in at least one group.
+	};
+
 	_FORCE_INLINE_ Window *get_root() const { return root; }
 
 	void call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount);
@@ -387,6 +433,10 @@ public:
 	void get_nodes_in_group(const StringName &p_group, List<Node *> *p_list);
 	Node *get_first_node_in_group(const StringName &p_group);
 	bool has_group(const StringName &p_identifier) const;
+	int get_node_count_in_group(const StringName &p_group) const;
+	// Unless p_tree_order is true, the nodes are returned in no particular order, which avoids sorting the groups.
+	void get_nodes_in_groups(const Vector<StringName> &p_groups, GroupQuery p_query, LocalVector<Node *> &r_nodes, bool p_tree_order = false);
+	PackedInt64Array _get_node_ids_in_groups(const TypedArray<StringName> &p_groups, GroupQuery p_query, bool p_tree_order);
 
 	//void change_scene(const String& p_path);
 	//Node *get_loaded_scene();
@@ -431,5 +481,6 @@ public:
 };
 
 VARIANT_ENUM_CAST(SceneTree::GroupCallFlags);
+VARIANT_ENUM_CAST(SceneTree::GroupQuery);
 
 #endif // SCENE_TREE_H
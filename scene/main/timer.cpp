@@ -30,6 +30,8 @@
 
 #include "timer.h"
 
+#include "scene/main/scene_tree.h"
+
 void Timer::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_READY: {
@@ -44,39 +46,57 @@ void Timer::_notification(int p_what) {
 			}
 		} break;
 
-		case NOTIFICATION_INTERNAL_PROCESS: {
-			if (!processing || timer_process_callback == TIMER_PROCESS_PHYSICS || !is_processing_internal()) {
-				return;
-			}
-			time_left -= ignore_time_scale ? get_process_delta_time() / Engine::get_singleton()->get_time_scale() : get_process_delta_time();
-
-			if (time_left < 0) {
-				if (!one_shot) {
-					time_left += wait_time;
-				} else {
-					stop();
-				}
+		case NOTIFICATION_ENTER_TREE:
+		case NOTIFICATION_PAUSED:
+		case NOTIFICATION_UNPAUSED:
+		case NOTIFICATION_DISABLED:
+		case NOTIFICATION_ENABLED: {
+			_update_scheduling();
+		} break;
 
-				emit_signal(SNAME("timeout"));
-			}
+		case NOTIFICATION_EXIT_TREE: {
+			_update_scheduling(true);
 		} break;
+	}
+}
 
-		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
-			if (!processing || timer_process_callback == TIMER_PROCESS_IDLE || !is_physics_processing_internal()) {
-				return;
-			}
-			time_left -= ignore_time_scale ? get_physics_process_delta_time() / Engine::get_singleton()->get_time_scale() : get_physics_process_delta_time();
+void Timer::_unschedule() {
+	MutexLock lock(SceneTree::timer_mutex);
+	if (wheel_item.wheel) {
+		time_left = wheel_item.get_time_left();
+		wheel_item.wheel->remove(&wheel_item);
+	} else if (wheel_item.expired) {
+		// Expired this frame, but the timeout wasn't emitted yet. Cancel it.
+		time_left = wheel_item.expired_time_left;
+		wheel_item.expired = false;
+	}
+}
 
-			if (time_left < 0) {
-				if (!one_shot) {
-					time_left += wait_time;
-				} else {
-					stop();
-				}
-				emit_signal(SNAME("timeout"));
-			}
-		} break;
+void Timer::_update_scheduling(bool p_exiting_tree) {
+	MutexLock lock(SceneTree::timer_mutex);
+	_unschedule();
+	if (!processing || paused || p_exiting_tree || !is_inside_tree() || !can_process()) {
+		return;
+	}
+	get_tree()->_schedule_timer(&wheel_item, timer_process_callback == TIMER_PROCESS_PHYSICS, ignore_time_scale ? SceneTree::TIMER_CLOCK_NODE_UNSCALED : SceneTree::TIMER_CLOCK_SCALED, true, time_left);
+}
+
+void Timer::_timeout() {
+	{
+		MutexLock lock(SceneTree::timer_mutex);
+		if (!wheel_item.expired) {
+			// Stopped or restarted after it expired, but before the timeout was emitted.
+			return;
+		}
+		wheel_item.expired = false;
+		if (!one_shot) {
+			time_left = wheel_item.expired_time_left + wait_time;
+			_update_scheduling();
+		} else {
+			stop();
+		}
 	}
+	emit_signal(SNAME("timeout"));
 }
 
 void Timer::set_wait_time(double p_time) {
@@ -111,11 +131,13 @@ void Timer::start(double p_time) {
 	if (p_time > 0) {
 		set_wait_time(p_time);
 	}
+	_unschedule();
 	time_left = wait_time;
 	_set_process(true);
 }
 
 void Timer::stop() {
+	_unschedule();
 	time_left = -1;
 	_set_process(false);
 	autostart = false;
@@ -135,7 +157,12 @@ bool Timer::is_paused() const {
 }
 
 void Timer::set_ignore_time_scale(bool p_ignore_time_scale) {
+	if (ignore_time_scale == p_ignore_time_scale) {
+		return;
+	}
+
 	ignore_time_scale = p_ignore_time_scale;
+	_update_scheduling();
 }
 
 bool Timer::get_ignore_time_scale() const {
@@ -147,7 +174,14 @@ bool Timer::is_stopped() const {
 }
 
 double Timer::get_time_left() const {
-	return time_left > 0 ? time_left : 0;
+	MutexLock lock(SceneTree::timer_mutex);
+	double left = time_left;
+	if (wheel_item.wheel) {
+		left = wheel_item.get_time_left();
+	} else if (wheel_item.expired) {
+		left = wheel_item.expired_time_left;
+	}
+	return left > 0 ? left : 0;
 }
 
 void Timer::set_timer_process_callback(TimerProcessCallback p_callback) {
@@ -155,21 +189,8 @@ void Timer::set_timer_process_callback(TimerProcessCallback p_callback) {
 		return;
 	}
 
-	switch (timer_process_callback) {
-		case TIMER_PROCESS_PHYSICS:
-			if (is_physics_processing_internal()) {
-				set_physics_process_internal(false);
-				set_process_internal(true);
-			}
-			break;
-		case TIMER_PROCESS_IDLE:
-			if (is_processing_internal()) {
-				set_process_internal(false);
-				set_physics_process_internal(true);
-			}
-			break;
-	}
 	timer_process_callback = p_callback;
+	_update_scheduling();
 }
 
 Timer::TimerProcessCallback Timer::get_timer_process_callback() const {
@@ -177,15 +198,8 @@ Timer::TimerProcessCallback Timer::get_timer_process_callback() const {
 }
 
 void Timer::_set_process(bool p_process, bool p_force) {
-	switch (timer_process_callback) {
-		case TIMER_PROCESS_PHYSICS:
-			set_physics_process_internal(p_process && !paused);
-			break;
-		case TIMER_PROCESS_IDLE:
-			set_process_internal(p_process && !paused);
-			break;
-	}
 	processing = p_process;
+	_update_scheduling();
 }
 
 PackedStringArray Timer::get_configuration_warnings() const {
@@ -238,4 +252,8 @@ void Timer::_bind_methods() {
 	BIND_ENUM_CONSTANT(TIMER_PROCESS_IDLE);
 }
 
-Timer::Timer() {}
+Timer::Timer() {
+	wheel_item.owner = get_instance_id();
+	// Like the per-frame countdown this replaces, only time out once the wait time is exceeded.
+	wheel_item.exclusive = true;
+}
@@ -32,6 +32,7 @@
 #define TIMER_H
 
 #include "scene/main/node.h"
+#include "scene/main/timer_wheel.h"
 
 class Timer : public Node {
 	GDCLASS(Timer, Node);
@@ -45,6 +46,14 @@ class Timer : public Node {
 
 	double time_left = -1.0;
 
+	// Scheduled in the SceneTree timer wheels while running, instead of counting down every frame.
+	friend class SceneTree;
+	TimerWheel::Item wheel_item;
+
+	void _unschedule();
+	void _update_scheduling(bool p_exiting_tree = false);
+	void _timeout();
+
 protected:
 	void _notification(int p_what);
 	static void _bind_methods();
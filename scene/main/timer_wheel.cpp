@@ -0,0 +1,216 @@
+/**************************************************************************/
+/*  timer_wheel.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "timer_wheel.h"
+
+uint64_t TimerWheel::_get_tick(double p_time) {
+	if (p_time <= 0.0) {
+		return 0;
+	}
+	const double tick = p_time * TICKS_PER_SECOND;
+	// Anything this far away is effectively never, keep it in the overflow list.
+	return tick < double(uint64_t(1) << 62) ? uint64_t(tick) : (uint64_t(1) << 62);
+}
+
+TimerWheel::Item::~Item() {
+	if (wheel) {
+		wheel->remove(this);
+	}
+}
+
+void TimerWheel::_insert(Item *p_item) {
+	const uint64_t tick = MAX(_get_tick(p_item->deadline), current_tick);
+
+	// Use the lowest level where the deadline falls in the same rotation as the current tick.
+	for (uint32_t level = 0; level < LEVEL_COUNT; level++) {
+		const uint32_t shift = SLOT_BITS * (level + 1);
+		if ((tick >> shift) == (current_tick >> shift)) {
+			const uint32_t slot = (tick >> (SLOT_BITS * level)) & (SLOT_COUNT - 1);
+			slots[level][slot].add(&p_item->list_item);
+			occupied[level] |= uint64_t(1) << slot;
+			p_item->level = level;
+			p_item->slot = slot;
+			return;
+		}
+	}
+
+	overflow.add(&p_item->list_item);
+	p_item->level = OVERFLOW_LEVEL;
+	p_item->slot = 0;
+}
+
+void TimerWheel::_unlink(Item *p_item) {
+	if (p_item->level == OVERFLOW_LEVEL) {
+		overflow.remove(&p_item->list_item);
+		return;
+	}
+
+	SelfList<Item>::List &list = slots[p_item->level][p_item->slot];
+	list.remove(&p_item->list_item);
+	if (!list.first()) {
+		occupied[p_item->level] &= ~(uint64_t(1) << p_item->slot);
+	}
+}
+
+void TimerWheel::_redistribute(SelfList<Item>::List &p_list) {
+	// Items can land in the same list again (from the overflow list), so detach them all first.
+	LocalVector<Item *> items;
+	while (p_list.first()) {
+		Item *item = p_list.first()->self();
+		_unlink(item);
+		items.push_back(item);
+	}
+	for (Item *item : items) {
+		_insert(item);
+	}
+}
+
+void TimerWheel::_cascade() {
+	// The current tick just entered a new rotation of level 0. Every upper level whose lower
+	// bits are all zero wrapped around as well. Redistribute from the top down, so items land
+	// in the lowest level that matches the new rotation.
+	uint32_t highest = 0;
+	for (uint32_t level = 1; level < LEVEL_COUNT; level++) {
+		if (current_tick & ((uint64_t(1) << (SLOT_BITS * level)) - 1)) {
+			break;
+		}
+		highest = level;
+	}
+
+	if (highest == LEVEL_COUNT - 1 && (current_tick & ((uint64_t(1) << (SLOT_BITS * LEVEL_COUNT)) - 1)) == 0) {
+		_redistribute(overflow);
+	}
+
+	for (uint32_t level = highest; level >= 1; level--) {
+		const uint32_t slot = (current_tick >> (SLOT_BITS * level)) & (SLOT_COUNT - 1);
+		if (occupied[level] & (uint64_t(1) << slot)) {
+			_redistribute(slots[level][slot]);
+		}
+	}
+}
+
+void TimerWheel::_expire_slot(uint32_t p_slot, LocalVector<Item *> &r_expired) {
+	SelfList<Item> *E = slots[0][p_slot].first();
+	while (E) {
+		SelfList<Item> *N = E->next();
+		Item *item = E->self();
+		// Only the slot of the last tick can hold items that are not due yet.
+		if (item->exclusive ? item->deadline < time : item->deadline <= time) {
+			_unlink(item);
+			item->wheel = nullptr;
+			item->expired = true;
+			item->expired_time_left = item->deadline - time;
+			item_count--;
+			r_expired.push_back(item);
+		}
+		E = N;
+	}
+}
+
+void TimerWheel::insert(Item *p_item, double p_time_left) {
+	ERR_FAIL_COND(p_item->wheel);
+
+	p_item->deadline = time + p_time_left;
+	p_item->wheel = this;
+	p_item->expired = false;
+	item_count++;
+	_insert(p_item);
+}
+
+void TimerWheel::remove(Item *p_item) {
+	ERR_FAIL_COND(p_item->wheel != this);
+
+	_unlink(p_item);
+	p_item->wheel = nullptr;
+	item_count--;
+}
+
+void TimerWheel::advance(double p_delta, LocalVector<Item *> &r_expired) {
+	time += MAX(p_delta, 0.0);
+	const uint64_t target_tick = _get_tick(time);
+
+	if (item_count == 0) {
+		current_tick = MAX(current_tick, target_tick);
+		return;
+	}
+
+	while (true) {
+		const uint32_t slot = current_tick & (SLOT_COUNT - 1);
+		if (occupied[0] & (uint64_t(1) << slot)) {
+			_expire_slot(slot, r_expired);
+		}
+
+		if (current_tick >= target_tick) {
+			break;
+		}
+
+		// Jump to the next occupied slot of this rotation, or to the start of the next rotation.
+		uint64_t next_tick = (current_tick | (SLOT_COUNT - 1)) + 1;
+		const uint64_t later = slot == SLOT_COUNT - 1 ? 0 : occupied[0] & ~((uint64_t(2) << slot) - 1);
+		if (later) {
+			uint32_t next_slot = slot + 1;
+			while (!(later & (uint64_t(1) << next_slot))) {
+				next_slot++;
+			}
+			next_tick = (current_tick & ~uint64_t(SLOT_COUNT - 1)) + next_slot;
+		}
+
+		if (next_tick > target_tick) {
+			current_tick = target_tick; // Same rotation, nothing to cascade.
+			continue;
+		}
+
+		current_tick = next_tick;
+		if ((current_tick & (SLOT_COUNT - 1)) == 0) {
+			_cascade();
+		}
+	}
+}
+
+void TimerWheel::clear(LocalVector<Item *> *r_items) {
+	for (uint32_t level = 0; level <= LEVEL_COUNT; level++) {
+		for (uint32_t slot = 0; slot < (level == OVERFLOW_LEVEL ? 1u : uint32_t(SLOT_COUNT)); slot++) {
+			SelfList<Item>::List &list = level == OVERFLOW_LEVEL ? overflow : slots[level][slot];
+			while (list.first()) {
+				Item *item = list.first()->self();
+				_unlink(item);
+				item->wheel = nullptr;
+				if (r_items) {
+					r_items->push_back(item);
+				}
+			}
+		}
+	}
+	item_count = 0;
+}
+
+TimerWheel::~TimerWheel() {
+	clear();
+}
@@ -0,0 +1,111 @@
+/**************************************************************************/
+/*  timer_wheel.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TIMER_WHEEL_H
+#define TIMER_WHEEL_H
+
+#include "core/object/object_id.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/self_list.h"
+
+// Hierarchical timing wheel, used by SceneTree to schedule SceneTreeTimers and Timer nodes.
+// Time is quantized to ticks of 1 ms. Level 0 has one slot per tick, and every following level
+// has slots that are 64 times wider. Advancing only visits the slots that are due (cascading
+// the upper levels down as the lower ones wrap around), so pending timers cost nothing until
+// they expire.
+class TimerWheel {
+public:
+	struct Item {
+		SelfList<Item> list_item;
+		ObjectID owner;
+		double deadline = 0.0; // In wheel time.
+		uint64_t order = 0; // Expired items are reported in this order.
+		bool exclusive = false; // If true, expires once the deadline is passed instead of reached.
+		bool expired = false;
+		double expired_time_left = 0.0; // Zero or negative, the overshoot when it expired.
+
+		TimerWheel *wheel = nullptr;
+		uint8_t level = 0;
+		uint8_t slot = 0;
+
+		_FORCE_INLINE_ double get_time_left() const { return deadline - wheel->time; }
+
+		Item() :
+				list_item(this) {}
+		~Item();
+	};
+
+	struct ItemOrderComparator {
+		_FORCE_INLINE_ bool operator()(const Item *p_a, const Item *p_b) const { return p_a->order < p_b->order; }
+	};
+
+private:
+	enum {
+		TICKS_PER_SECOND = 1000,
+		SLOT_BITS = 6,
+		SLOT_COUNT = 1 << SLOT_BITS,
+		LEVEL_COUNT = 4, // About 4.6 hours, later deadlines go to the overflow list.
+		OVERFLOW_LEVEL = LEVEL_COUNT,
+	};
+
+	SelfList<Item>::List slots[LEVEL_COUNT][SLOT_COUNT];
+	SelfList<Item>::List overflow;
+	uint64_t occupied[LEVEL_COUNT] = {};
+
+	double time = 0.0;
+	uint64_t current_tick = 0;
+	uint32_t item_count = 0;
+
+	static uint64_t _get_tick(double p_time);
+
+	void _insert(Item *p_item);
+	void _unlink(Item *p_item);
+	void _redistribute(SelfList<Item>::List &p_list);
+	void _cascade();
+	void _expire_slot(uint32_t p_slot, LocalVector<Item *> &r_expired);
+
+public:
+	_FORCE_INLINE_ double get_time() const { return time; }
+	_FORCE_INLINE_ uint32_t get_item_count() const { return item_count; }
+
+	// Schedules p_item to expire p_time_left seconds from now.
+	void insert(Item *p_item, double p_time_left);
+	void remove(Item *p_item);
+
+	// Moves time forward and appends the items that expired to r_expired (unsorted).
+	void advance(double p_delta, LocalVector<Item *> &r_expired);
+
+	// Removes all items, appending them to r_items if given.
+	void clear(LocalVector<Item *> *r_items = nullptr);
+
+	~TimerWheel();
+};
+
+#endif // TIMER_WHEEL_H
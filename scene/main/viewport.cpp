@@ -45,6 +45,7 @@
 #include "scene/3d/collision_object_3d.h"
 #include "scene/3d/world_environment.h"
 #endif // _3D_DISABLED
+#include "scene/gui/container.h"
 #include "scene/gui/control.h"
 #include "scene/gui/label.h"
 #include "scene/gui/popup.h"
@@ -1062,6 +1063,7 @@ void Viewport::canvas_parent_mark_dirty(Node *p_node) {
 	ERR_MAIN_THREAD_GUARD;
 	bool request_update = gui.canvas_parents_with_dirty_order.is_empty();
 	gui.canvas_parents_with_dirty_order.insert(p_node->get_instance_id());
+	_gui_invalidate_pick_index();
 	if (request_update) {
 		MessageQueue::get_singleton()->push_callable(callable_mp(this, &Viewport::_process_dirty_canvas_parent_orders));
 	}
@@ -1419,6 +1421,7 @@ void Viewport::_gui_sort_roots() {
 	gui.roots.sort_custom<Control::CComparator>();
 
 	gui.roots_order_dirty = false;
+	_gui_invalidate_pick_index();
 }
 
 void Viewport::_gui_cancel_tooltip() {
@@ -1660,73 +1663,320 @@ void Viewport::_gui_call_notification(Control *p_control, int p_what) {
 	}
 }
 
-Control *Viewport::gui_find_control(const Point2 &p_global) {
-	ERR_MAIN_THREAD_GUARD_V(nullptr);
-	// Handle subwindows.
-	_gui_sort_roots();
+Transform2D Viewport::_gui_get_root_transform(Control *p_root) const {
+	CanvasItem *pci = p_root->get_parent_item();
+	if (pci) {
+		return pci->get_global_transform_with_canvas();
+	}
+	return p_root->get_canvas_transform();
+}
 
-	for (List<Control *>::Element *E = gui.roots.back(); E; E = E->prev()) {
-		Control *sw = E->get();
-		if (!sw->is_visible_in_tree()) {
-			continue;
+void Viewport::_gui_invalidate_pick_index(CanvasItem *p_item, bool p_transform_changed) {
+	if (gui.pick_index.dirty) {
+		return;
+	}
+	// Moving canvas items outside of the GUI (or without Controls below them) doesn't change picking.
+	if (p_transform_changed && p_item && !Object::cast_to<Control>(p_item) && !gui.pick_index.intermediate_items.has(p_item)) {
+		return;
+	}
+	// The drag preview follows the mouse, but it is never picked, so it doesn't need an index update.
+	if (p_item && p_item->get_instance_id() == gui.drag_preview_id) {
+		return;
+	}
+	gui.pick_index.dirty = true;
+}
+
+void Viewport::_gui_add_to_pick_index(CanvasItem *p_node, const Transform2D &p_xform, int p_clip, Control *p_drag_preview) {
+	if (!p_node->is_visible()) {
+		return; // Canvas item hidden, discard.
+	}
+
+	GUIPickIndex &pick = gui.pick_index;
+	Transform2D matrix = p_xform * p_node->get_transform();
+	// matrix.determinant() == 0.0f implies that node does not exist on scene
+	if (matrix.determinant() == 0.0f) {
+		// Its Controls show up again once the transform is invertible.
+		pick.intermediate_items.insert(p_node);
+		return;
+	}
+
+	const uint32_t indexed_count = pick.entries.size() + pick.clips.size();
+	Control *c = Object::cast_to<Control>(p_node);
+	if (c) {
+		if (c == p_drag_preview) {
+			return;
 		}
 
-		Transform2D xform;
-		CanvasItem *pci = sw->get_parent_item();
-		if (pci) {
-			xform = pci->get_global_transform_with_canvas();
-		} else {
-			xform = sw->get_canvas_transform();
+		Transform2D inv_xform = matrix.affine_inverse();
+		if (c->data.mouse_filter != Control::MOUSE_FILTER_IGNORE) {
+			GUIPickIndex::Entry entry;
+			entry.control = c;
+			entry.inv_xform = inv_xform;
+			// Pad by a pixel, so that rounding in the inverse transform can't drop points on the edges.
+			entry.rect = matrix.xform(Rect2(Point2(), c->get_size())).grow(1);
+			entry.clip = p_clip;
+			if (c->_has_point_outside_rect() || !entry.rect.is_finite()) {
+				pick.unbounded.push_back(pick.entries.size());
+			}
+			pick.entries.push_back(entry);
 		}
 
-		Control *ret = _gui_find_control_at_pos(sw, p_global, xform);
-		if (ret) {
-			return ret;
+		if (c->is_clipping_contents()) {
+			GUIPickIndex::Clip clip;
+			clip.control = c;
+			clip.inv_xform = inv_xform;
+			clip.parent = p_clip;
+			pick.clips.push_back(clip);
+			p_clip = pick.clips.size() - 1;
 		}
 	}
 
-	return nullptr;
+	// Children are added after their parent and after earlier siblings, matching the reverse of the
+	// order in which they are tested.
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		CanvasItem *ci = Object::cast_to<CanvasItem>(p_node->get_child(i));
+		if (!ci || ci->is_set_as_top_level()) {
+			continue;
+		}
+
+		_gui_add_to_pick_index(ci, matrix, p_clip, p_drag_preview);
+	}
+
+	if (!c && pick.entries.size() + pick.clips.size() > indexed_count) {
+		pick.intermediate_items.insert(p_node);
+	}
 }
 
-Control *Viewport::_gui_find_control_at_pos(CanvasItem *p_node, const Point2 &p_global, const Transform2D &p_xform) {
-	if (!p_node->is_visible()) {
-		return nullptr; // Canvas item hidden, discard.
+void Viewport::_gui_update_pick_index() {
+	GUIPickIndex &pick = gui.pick_index;
+
+	// Transforms above the roots (canvas layers, the canvas transform, parent canvas items of top level
+	// Controls) aren't tracked, so check them here instead.
+	if (!pick.dirty) {
+		if (pick.root_xforms.size() != (uint32_t)gui.roots.size()) {
+			pick.dirty = true;
+		} else {
+			uint32_t i = 0;
+			for (Control *root : gui.roots) {
+				if (pick.root_xforms[i++] != _gui_get_root_transform(root)) {
+					pick.dirty = true;
+					break;
+				}
+			}
+		}
+		if (!pick.dirty) {
+			return;
+		}
 	}
 
-	Transform2D matrix = p_xform * p_node->get_transform();
-	// matrix.determinant() == 0.0f implies that node does not exist on scene
-	if (matrix.determinant() == 0.0f) {
-		return nullptr;
+	pick.clips.clear();
+	pick.entries.clear();
+	pick.unbounded.clear();
+	pick.root_xforms.clear();
+	pick.intermediate_items.clear();
+
+	Control *drag_preview = _gui_get_drag_preview();
+	for (Control *root : gui.roots) {
+		Transform2D xform = _gui_get_root_transform(root);
+		pick.root_xforms.push_back(xform);
+		if (root->is_visible_in_tree()) {
+			_gui_add_to_pick_index(root, xform, -1, drag_preview);
+		}
 	}
 
-	Control *c = Object::cast_to<Control>(p_node);
+	// Bucket the bounded entries into a grid of roughly four entries per cell.
+	pick.grid_rect = Rect2();
+	bool first = true;
+	uint32_t unbounded_idx = 0;
+	for (uint32_t i = 0; i < pick.entries.size(); i++) {
+		if (unbounded_idx < pick.unbounded.size() && pick.unbounded[unbounded_idx] == i) {
+			unbounded_idx++;
+			continue;
+		}
+		if (first) {
+			pick.grid_rect = pick.entries[i].rect;
+			first = false;
+		} else {
+			pick.grid_rect = pick.grid_rect.merge(pick.entries[i].rect);
+		}
+	}
+
+	int cells_per_axis = CLAMP((int)Math::ceil(Math::sqrt((pick.entries.size() - pick.unbounded.size()) / 4.0)), 1, 128);
+	pick.grid_size = Size2i(cells_per_axis, cells_per_axis);
+	pick.cell_scale.x = pick.grid_rect.size.x > 0 ? pick.grid_size.x / pick.grid_rect.size.x : 0;
+	pick.cell_scale.y = pick.grid_rect.size.y > 0 ? pick.grid_size.y / pick.grid_rect.size.y : 0;
 
-	if (!c || !c->is_clipping_contents() || c->has_point(matrix.affine_inverse().xform(p_global))) {
-		for (int i = p_node->get_child_count() - 1; i >= 0; i--) {
-			CanvasItem *ci = Object::cast_to<CanvasItem>(p_node->get_child(i));
-			if (!ci || ci->is_set_as_top_level()) {
+	pick.cell_offsets.resize(pick.grid_size.x * pick.grid_size.y + 1);
+	for (uint32_t &offset : pick.cell_offsets) {
+		offset = 0;
+	}
+
+	// Counting pass, then a prefix sum, then a filling pass that keeps each cell in ascending order.
+	for (int pass = 0; pass < 2; pass++) {
+		unbounded_idx = 0;
+		for (uint32_t i = 0; i < pick.entries.size(); i++) {
+			if (unbounded_idx < pick.unbounded.size() && pick.unbounded[unbounded_idx] == i) {
+				unbounded_idx++;
 				continue;
 			}
 
-			Control *ret = _gui_find_control_at_pos(ci, p_global, matrix);
-			if (ret) {
-				return ret;
+			const Rect2 &rect = pick.entries[i].rect;
+			Vector2 from = (rect.position - pick.grid_rect.position) * pick.cell_scale;
+			Vector2 to = (rect.get_end() - pick.grid_rect.position) * pick.cell_scale;
+			int from_x = CLAMP((int)from.x, 0, pick.grid_size.x - 1);
+			int from_y = CLAMP((int)from.y, 0, pick.grid_size.y - 1);
+			int to_x = CLAMP((int)to.x, 0, pick.grid_size.x - 1);
+			int to_y = CLAMP((int)to.y, 0, pick.grid_size.y - 1);
+			for (int y = from_y; y <= to_y; y++) {
+				for (int x = from_x; x <= to_x; x++) {
+					uint32_t cell = y * pick.grid_size.x + x;
+					if (pass == 0) {
+						pick.cell_offsets[cell + 1]++;
+					} else {
+						pick.cell_entries[pick.cell_offsets[cell]++] = i;
+					}
+				}
+			}
+		}
+
+		if (pass == 0) {
+			for (uint32_t cell = 1; cell < pick.cell_offsets.size(); cell++) {
+				pick.cell_offsets[cell] += pick.cell_offsets[cell - 1];
+			}
+			pick.cell_entries.resize(pick.cell_offsets[pick.cell_offsets.size() - 1]);
+		} else {
+			// Filling advanced every offset to the start of the next cell, shift them back.
+			for (uint32_t cell = pick.cell_offsets.size() - 1; cell > 0; cell--) {
+				pick.cell_offsets[cell] = pick.cell_offsets[cell - 1];
 			}
+			pick.cell_offsets[0] = 0;
 		}
 	}
 
-	if (!c || c->data.mouse_filter == Control::MOUSE_FILTER_IGNORE) {
-		return nullptr;
+	pick.dirty = false;
+}
+
+bool Viewport::_gui_pick_index_clips_point(int p_clip, const Point2 &p_global) const {
+	while (p_clip != -1) {
+		const GUIPickIndex::Clip &clip = gui.pick_index.clips[p_clip];
+		if (!clip.control->has_point(clip.inv_xform.xform(p_global))) {
+			return true;
+		}
+		p_clip = clip.parent;
 	}
+	return false;
+}
 
-	matrix.affine_invert();
-	if (!c->has_point(matrix.xform(p_global))) {
-		return nullptr;
+void Viewport::_gui_queue_layout_flush() {
+	if (gui.layout_flush_queued) {
+		return;
 	}
+	MessageQueue::get_singleton()->push_callable(callable_mp(this, &Viewport::_gui_flush_layout));
+	gui.layout_flush_queued = true;
+}
 
-	Control *drag_preview = _gui_get_drag_preview();
-	if (!drag_preview || (c != drag_preview && !drag_preview->is_ancestor_of(c))) {
-		return c;
+void Viewport::_gui_queue_minimum_size_update(Control *p_control) {
+	gui.layout_minimum_size_queue.push_back(p_control->get_instance_id());
+	_gui_queue_layout_flush();
+}
+
+void Viewport::_gui_queue_sort(Container *p_container) {
+	gui.layout_sort_queue.push_back(p_container->get_instance_id());
+	_gui_queue_layout_flush();
+}
+
+struct _LayoutDeepestFirst {
+	_FORCE_INLINE_ bool operator()(const Pair<int, ObjectID> &p_a, const Pair<int, ObjectID> &p_b) const {
+		return p_a.first > p_b.first;
+	}
+};
+
+struct _LayoutShallowestFirst {
+	_FORCE_INLINE_ bool operator()(const Pair<int, ObjectID> &p_a, const Pair<int, ObjectID> &p_b) const {
+		return p_a.first < p_b.first;
+	}
+};
+
+void Viewport::_gui_flush_layout() {
+	// Minimum size changes travel up the tree and sorts resize children down the tree, so update the
+	// queued minimum sizes deepest first, then sort the queued containers shallowest first. This way a
+	// container is sorted once per flush, after its ancestors gave it its final size, no matter how many
+	// of its descendants changed. Anything queued while flushing is handled in the next round.
+	LocalVector<Pair<int, ObjectID>> batch;
+	// Controls that left the tree are kept, so that they can clear their pending state.
+	auto take_queue = [&batch](LocalVector<ObjectID> &r_queue) {
+		batch.clear();
+		for (const ObjectID &id : r_queue) {
+			Node *node = Object::cast_to<Node>(ObjectDB::get_instance(id));
+			if (node) {
+				batch.push_back(Pair<int, ObjectID>(node->data.depth, id));
+			}
+		}
+		r_queue.clear();
+	};
+
+	while (!gui.layout_minimum_size_queue.is_empty() || !gui.layout_sort_queue.is_empty()) {
+		if (!gui.layout_minimum_size_queue.is_empty()) {
+			take_queue(gui.layout_minimum_size_queue);
+			batch.sort_custom<_LayoutDeepestFirst>();
+			for (const Pair<int, ObjectID> &E : batch) {
+				Control *control = Object::cast_to<Control>(ObjectDB::get_instance(E.second));
+				if (control) {
+					control->_update_minimum_size();
+				}
+			}
+			continue;
+		}
+
+		take_queue(gui.layout_sort_queue);
+		batch.sort_custom<_LayoutShallowestFirst>();
+		for (const Pair<int, ObjectID> &E : batch) {
+			Container *container = Object::cast_to<Container>(ObjectDB::get_instance(E.second));
+			if (container && container->pending_sort) {
+				container->_sort_children();
+			}
+		}
+	}
+
+	gui.layout_flush_queued = false;
+}
+
+Control *Viewport::gui_find_control(const Point2 &p_global) {
+	ERR_MAIN_THREAD_GUARD_V(nullptr);
+	// Handle subwindows.
+	_gui_sort_roots();
+	_gui_update_pick_index();
+
+	const GUIPickIndex &pick = gui.pick_index;
+
+	const uint32_t *cell_entries = nullptr;
+	int64_t cell_idx = -1;
+	Point2 grid_pos = p_global - pick.grid_rect.position;
+	if (grid_pos.x >= 0 && grid_pos.y >= 0 && grid_pos.x <= pick.grid_rect.size.x && grid_pos.y <= pick.grid_rect.size.y && !pick.cell_entries.is_empty()) {
+		Vector2 cell_pos = grid_pos * pick.cell_scale;
+		uint32_t cell = MIN((int)cell_pos.y, pick.grid_size.y - 1) * pick.grid_size.x + MIN((int)cell_pos.x, pick.grid_size.x - 1);
+		cell_entries = pick.cell_entries.ptr() + pick.cell_offsets[cell];
+		cell_idx = int64_t(pick.cell_offsets[cell + 1] - pick.cell_offsets[cell]) - 1;
+	}
+	int64_t unbounded_idx = int64_t(pick.unbounded.size()) - 1;
+
+	// Both lists are in ascending order and don't share entries, so merge them from the back.
+	while (cell_idx >= 0 || unbounded_idx >= 0) {
+		uint32_t idx;
+		if (unbounded_idx < 0 || (cell_idx >= 0 && cell_entries[cell_idx] > pick.unbounded[unbounded_idx])) {
+			idx = cell_entries[cell_idx--];
+		} else {
+			idx = pick.unbounded[unbounded_idx--];
+		}
+
+		const GUIPickIndex::Entry &entry = pick.entries[idx];
+		if (!entry.control->has_point(entry.inv_xform.xform(p_global))) {
+			continue;
+		}
+		if (_gui_pick_index_clips_point(entry.clip, p_global)) {
+			continue;
+		}
+		return entry.control;
 	}
 
 	return nullptr;
@@ -2348,6 +2598,7 @@ void Viewport::_gui_cleanup_internal_state(Ref<InputEvent> p_event) {
 
 List<Control *>::Element *Viewport::_gui_add_root_control(Control *p_control) {
 	gui.roots_order_dirty = true;
+	_gui_invalidate_pick_index();
 	return gui.roots.push_back(p_control);
 }
 
@@ -2401,6 +2652,7 @@ Control *Viewport::_gui_get_drag_preview() {
 
 void Viewport::_gui_remove_root_control(List<Control *>::Element *RI) {
 	gui.roots.erase(RI);
+	_gui_invalidate_pick_index();
 }
 
 void Viewport::_gui_unfocus_control(Control *p_control) {
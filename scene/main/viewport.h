@@ -45,6 +45,7 @@ class AudioListener2D;
 class Camera2D;
 class CanvasItem;
 class CanvasLayer;
+class Container;
 class Control;
 class Label;
 class SceneTreeTimer;
@@ -350,6 +351,41 @@ private:
 	VRSMode vrs_mode = VRS_DISABLED;
 	Ref<Texture2D> vrs_texture;
 
+	// Flattened copy of the pickable Controls, so that gui_find_control() only has to test the few
+	// candidates near the point instead of walking the whole tree. It is rebuilt lazily after anything
+	// that affects picking changes (transforms, sizes, visibility, tree order, mouse filters, clipping).
+	struct GUIPickIndex {
+		struct Clip {
+			Control *control = nullptr;
+			Transform2D inv_xform;
+			int parent = -1;
+		};
+
+		struct Entry {
+			Control *control = nullptr;
+			Transform2D inv_xform;
+			Rect2 rect; // Global bounds, padded.
+			int clip = -1; // Innermost clipping ancestor in clips.
+		};
+
+		LocalVector<Clip> clips;
+		LocalVector<Entry> entries; // Sorted by priority, the last one is tested first.
+		LocalVector<uint32_t> unbounded; // Entries whose has_point() can reach outside their rect.
+		LocalVector<Transform2D> root_xforms;
+		// Canvas items that aren't Controls but have indexed Controls below them. Besides the ones of
+		// Controls, only their transforms affect the index. The pointers are only compared.
+		HashSet<const CanvasItem *> intermediate_items;
+
+		// Uniform grid over the bounded entries, each cell lists its entries in ascending order.
+		Rect2 grid_rect;
+		Size2i grid_size;
+		Vector2 cell_scale;
+		LocalVector<uint32_t> cell_offsets;
+		LocalVector<uint32_t> cell_entries;
+
+		bool dirty = true;
+	};
+
 	struct GUI {
 		bool forced_mouse_focus = false; //used for menu buttons
 		bool mouse_in_viewport = true;
@@ -381,6 +417,11 @@ private:
 		bool roots_order_dirty = false;
 		List<Control *> roots;
 		HashSet<ObjectID> canvas_parents_with_dirty_order;
+		GUIPickIndex pick_index;
+		// Controls waiting for a minimum size update and Containers waiting for a sort, see _gui_flush_layout().
+		LocalVector<ObjectID> layout_minimum_size_queue;
+		LocalVector<ObjectID> layout_sort_queue;
+		bool layout_flush_queued = false;
 		int canvas_sort_index = 0; //for sorting items with canvas as root
 		bool dragging = false;
 		bool drag_successful = false;
@@ -408,7 +449,16 @@ private:
 	void _gui_call_notification(Control *p_control, int p_what);
 
 	void _gui_sort_roots();
-	Control *_gui_find_control_at_pos(CanvasItem *p_node, const Point2 &p_global, const Transform2D &p_xform);
+	Transform2D _gui_get_root_transform(Control *p_root) const;
+	void _gui_invalidate_pick_index(CanvasItem *p_item = nullptr, bool p_transform_changed = false);
+	void _gui_add_to_pick_index(CanvasItem *p_node, const Transform2D &p_xform, int p_clip, Control *p_drag_preview);
+	void _gui_update_pick_index();
+	bool _gui_pick_index_clips_point(int p_clip, const Point2 &p_global) const;
+
+	void _gui_queue_layout_flush();
+	void _gui_queue_minimum_size_update(Control *p_control);
+	void _gui_queue_sort(Container *p_container);
+	void _gui_flush_layout();
 
 	void _gui_input_event(Ref<InputEvent> p_event);
 	void _perform_drop(Control *p_control = nullptr, Point2 p_pos = Point2());
@@ -418,6 +468,9 @@ private:
 
 	Ref<InputEvent> _make_input_local(const Ref<InputEvent> &ev);
 
+	friend class CanvasItem;
+	friend class Container;
+	friend class TestViewportAccessor;
 	friend class Control;
 
 	List<Control *>::Element *_gui_add_root_control(Control *p_control);
@@ -82,6 +82,9 @@ class ImporterMesh : public Resource {
 
 	Size2i lightmap_size_hint;
 
+	struct GenerateLODsData;
+	void _generate_surface_lods(uint32_t p_surface, const GenerateLODsData *p_data);
+
 protected:
 	void _set_data(const Dictionary &p_data);
 	Dictionary _get_data() const;
@@ -1034,6 +1034,20 @@ void SurfaceTool::append_from(const Ref<Mesh> &p_existing, int p_surface, const
 	}
 	int vfrom = vertex_array.size();
 
+	// When mixing indexed and non-indexed surfaces, index the side that has no
+	// indices, otherwise its triangles would be dropped from the index array.
+	if (nindices.is_empty() && !index_array.is_empty()) {
+		nindices.resize(nvertices.size());
+		for (uint32_t i = 0; i < nvertices.size(); i++) {
+			nindices[i] = i;
+		}
+	} else if (!nindices.is_empty() && index_array.is_empty()) {
+		index_array.resize(vfrom);
+		for (int i = 0; i < vfrom; i++) {
+			index_array[i] = i;
+		}
+	}
+
 	for (Vertex &v : nvertices) {
 		v.vertex = p_xform.xform(v.vertex);
 		if (nformat & RS::ARRAY_FORMAT_NORMAL) {
@@ -124,9 +124,34 @@ void MovieWriter::begin(const Size2i &p_movie_size, uint32_t p_fps, const String
 	audio_channels = AudioDriverDummy::get_dummy_singleton()->get_channels();
 	audio_mix_buffer.resize(mix_rate * audio_channels / fps);
 
+	_begin_encoding();
+
 	write_begin(p_movie_size, p_fps, p_base_path);
 }
 
+void MovieWriter::_begin_encoding() {
+	// Writers that support it get their frames encoded on worker threads, with up to
+	// `max_frames_in_flight` frames queued before add_frame() blocks on the oldest one.
+	uint32_t frames_in_flight = 1;
+	if (supports_threaded_encoding()) {
+		int max_frames = GLOBAL_GET("editor/movie_writer/max_frames_in_flight");
+		if (max_frames <= 0) {
+			max_frames = WorkerThreadPool::get_singleton()->get_thread_count();
+		}
+		frames_in_flight = MAX(max_frames, 1);
+	}
+
+	encode_ring.clear();
+	if (frames_in_flight > 1) {
+		encode_ring.resize(frames_in_flight);
+		for (EncodeSlot &slot : encode_ring) {
+			slot.audio.resize(audio_mix_buffer.size());
+		}
+	}
+	encode_ring_head = 0;
+	encode_ring_used = 0;
+}
+
 void MovieWriter::_bind_methods() {
 	ClassDB::bind_static_method("MovieWriter", D_METHOD("add_writer", "writer"), &MovieWriter::add_writer);
 
@@ -142,6 +167,7 @@ void MovieWriter::_bind_methods() {
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "editor/movie_writer/mix_rate", PROPERTY_HINT_RANGE, "8000,192000,1,suffix:Hz"), 48000);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "editor/movie_writer/speaker_mode", PROPERTY_HINT_ENUM, "Stereo,3.1,5.1,7.1"), 0);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "editor/movie_writer/mjpeg_quality", PROPERTY_HINT_RANGE, "0.01,1.0,0.01"), 0.75);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "editor/movie_writer/max_frames_in_flight", PROPERTY_HINT_RANGE, "0,64,1"), 0);
 	// Used by the editor.
 	GLOBAL_DEF_BASIC("editor/movie_writer/movie_file", "");
 	GLOBAL_DEF_BASIC("editor/movie_writer/disable_vsync", false);
@@ -192,10 +218,66 @@ void MovieWriter::add_frame() {
 	gpu_time += RenderingServer::get_singleton()->viewport_get_measured_render_time_gpu(main_vp_rid);
 
 	AudioDriverDummy::get_dummy_singleton()->mix_audio(mix_rate / fps, audio_mix_buffer.ptr());
-	write_frame(vp_tex, audio_mix_buffer.ptr());
+
+	_submit_frame(vp_tex, audio_mix_buffer.ptr());
+}
+
+void MovieWriter::_submit_frame(const Ref<Image> &p_image, const int32_t *p_audio_data) {
+	if (encode_ring.is_empty()) {
+		write_frame(p_image, p_audio_data);
+		return;
+	}
+
+	if (encode_ring_used == encode_ring.size()) {
+		// Every slot is busy, wait for the oldest frame so memory usage stays bounded.
+		_write_oldest_encoded_frame();
+	}
+
+	// texture_2d_get() returns a new image every frame, so the slot can keep a reference
+	// to it. The audio block is copied since the mix buffer is reused for the next frame.
+	uint32_t slot_index = (encode_ring_head + encode_ring_used) % encode_ring.size();
+	EncodeSlot &slot = encode_ring[slot_index];
+	slot.image = p_image;
+	memcpy(slot.audio.ptr(), p_audio_data, slot.audio.size() * sizeof(int32_t));
+	slot.task_id = WorkerThreadPool::get_singleton()->add_template_task(this, &MovieWriter::_encode_frame_task, slot_index, false, SNAME("MovieWriterEncodeFrame"));
+	encode_ring_used++;
+
+	_flush_encoded_frames(false);
+}
+
+void MovieWriter::_encode_frame_task(uint32_t p_slot) {
+	EncodeSlot &slot = encode_ring[p_slot];
+	slot.encoded = encode_frame(slot.image);
+	slot.image.unref();
+}
+
+void MovieWriter::_write_oldest_encoded_frame() {
+	EncodeSlot &slot = encode_ring[encode_ring_head];
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(slot.task_id);
+	slot.task_id = WorkerThreadPool::INVALID_TASK_ID;
+
+	write_encoded_frame(slot.encoded, slot.audio.ptr());
+	slot.encoded.clear();
+
+	encode_ring_head = (encode_ring_head + 1) % encode_ring.size();
+	encode_ring_used--;
+}
+
+void MovieWriter::_flush_encoded_frames(bool p_wait) {
+	// Frames are muxed in submission order. Without p_wait, stop at the first frame
+	// still being encoded even if later ones are already done.
+	while (encode_ring_used > 0) {
+		if (!p_wait && !WorkerThreadPool::get_singleton()->is_task_completed(encode_ring[encode_ring_head].task_id)) {
+			break;
+		}
+		_write_oldest_encoded_frame();
+	}
 }
 
 void MovieWriter::end() {
+	_flush_encoded_frames(true);
+	encode_ring.clear();
+
 	write_end();
 
 	// Print a report with various statistics.
@@ -31,6 +31,7 @@
 #ifndef MOVIE_WRITER_H
 #define MOVIE_WRITER_H
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/local_vector.h"
 #include "servers/audio/audio_driver_dummy.h"
 #include "servers/audio_server.h"
@@ -38,6 +39,8 @@
 class MovieWriter : public Object {
 	GDCLASS(MovieWriter, Object);
 
+	friend class TestMovieWriterAccessor;
+
 	uint64_t fps = 0;
 	uint64_t mix_rate = 0;
 	uint32_t audio_channels = 0;
@@ -49,6 +52,26 @@ class MovieWriter : public Object {
 
 	LocalVector<int32_t> audio_mix_buffer;
 
+	// Frames whose image is being encoded on the WorkerThreadPool. This is a
+	// ring buffer: frames are handed to the muxer strictly in submission order,
+	// so the output does not depend on which encode task finishes first.
+	struct EncodeSlot {
+		Ref<Image> image;
+		LocalVector<int32_t> audio;
+		Vector<uint8_t> encoded;
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::INVALID_TASK_ID;
+	};
+
+	LocalVector<EncodeSlot> encode_ring;
+	uint32_t encode_ring_head = 0;
+	uint32_t encode_ring_used = 0;
+
+	void _begin_encoding();
+	void _submit_frame(const Ref<Image> &p_image, const int32_t *p_audio_data);
+	void _encode_frame_task(uint32_t p_slot);
+	void _write_oldest_encoded_frame();
+	void _flush_encoded_frames(bool p_wait);
+
 	enum {
 		MAX_WRITERS = 8
 	};
@@ -63,6 +86,13 @@ protected:
 	virtual Error write_frame(const Ref<Image> &p_image, const int32_t *p_audio_data);
 	virtual void write_end();
 
+	// Writers that can separate image encoding from muxing override these so
+	// MovieWriter can encode several frames in parallel. encode_frame() is
+	// called from worker threads and must not modify the writer's state.
+	virtual bool supports_threaded_encoding() const { return false; }
+	virtual Vector<uint8_t> encode_frame(const Ref<Image> &p_image) const { return Vector<uint8_t>(); }
+	virtual Error write_encoded_frame(const Vector<uint8_t> &p_encoded, const int32_t *p_audio_data) { return ERR_UNAVAILABLE; }
+
 	GDVIRTUAL0RC(uint32_t, _get_audio_mix_rate)
 	GDVIRTUAL0RC(AudioServer::SpeakerMode, _get_audio_speaker_mode)
 
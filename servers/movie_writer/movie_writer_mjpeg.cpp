@@ -191,9 +191,17 @@ Error MovieWriterMJPEG::write_begin(const Size2i &p_movie_size, uint32_t p_fps,
 }
 
 Error MovieWriterMJPEG::write_frame(const Ref<Image> &p_image, const int32_t *p_audio_data) {
+	return write_encoded_frame(encode_frame(p_image), p_audio_data);
+}
+
+Vector<uint8_t> MovieWriterMJPEG::encode_frame(const Ref<Image> &p_image) const {
+	return p_image->save_jpg_to_buffer(quality);
+}
+
+Error MovieWriterMJPEG::write_encoded_frame(const Vector<uint8_t> &p_encoded, const int32_t *p_audio_data) {
 	ERR_FAIL_COND_V(!f.is_valid(), ERR_UNCONFIGURED);
 
-	Vector<uint8_t> jpg_buffer = p_image->save_jpg_to_buffer(quality);
+	const Vector<uint8_t> &jpg_buffer = p_encoded;
 	uint32_t s = jpg_buffer.size();
 
 	f->store_buffer((const uint8_t *)"00db", 4); // Stream 0, Video
@@ -140,9 +140,17 @@ Error MovieWriterPNGWAV::write_begin(const Size2i &p_movie_size, uint32_t p_fps,
 }
 
 Error MovieWriterPNGWAV::write_frame(const Ref<Image> &p_image, const int32_t *p_audio_data) {
+	return write_encoded_frame(encode_frame(p_image), p_audio_data);
+}
+
+Vector<uint8_t> MovieWriterPNGWAV::encode_frame(const Ref<Image> &p_image) const {
+	return p_image->save_png_to_buffer();
+}
+
+Error MovieWriterPNGWAV::write_encoded_frame(const Vector<uint8_t> &p_encoded, const int32_t *p_audio_data) {
 	ERR_FAIL_COND_V(!f_wav.is_valid(), ERR_UNCONFIGURED);
 
-	Vector<uint8_t> png_buffer = p_image->save_png_to_buffer();
+	const Vector<uint8_t> &png_buffer = p_encoded;
 
 	Ref<FileAccess> fi = FileAccess::open(base_path + zeros_str(frame_count) + ".png", FileAccess::WRITE);
 	fi->store_buffer(png_buffer.ptr(), png_buffer.size());
@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/math/geometry_2d.h"
+#include "core/object/worker_thread_pool.h"
 #include "renderer_viewport.h"
 #include "rendering_server_default.h"
 #include "rendering_server_globals.h"
@@ -50,6 +51,11 @@ void RendererCanvasCull::_render_canvas_item_tree(RID p_to_render_target, Canvas
 		_cull_canvas_item(p_canvas_item, p_transform, p_clip_rect, Color(1, 1, 1, 1), 0, z_list, z_last_list, nullptr, nullptr, true, canvas_cull_mask);
 	}
 
+	if (cull_redraw_requested.is_set()) {
+		cull_redraw_requested.clear();
+		RenderingServerDefault::redraw_request();
+	}
+
 	RendererCanvasRender::Item *list = nullptr;
 	RendererCanvasRender::Item *list_end = nullptr;
 
@@ -186,7 +192,8 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 		//something to draw?
 
 		if (ci->update_when_visible) {
-			RenderingServerDefault::redraw_request();
+			// May run on a worker thread, so the request is forwarded once culling is done.
+			cull_redraw_requested.set();
 		}
 
 		if (ci->commands != nullptr || ci->copy_back_buffer) {
@@ -198,6 +205,12 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 
 			int zidx = p_z - RS::CANVAS_ITEM_Z_MIN;
 
+			ThreadedCullList *thread_list = current_thread_cull_list;
+			if (thread_list) {
+				thread_list->z_min = MIN(thread_list->z_min, zidx);
+				thread_list->z_max = MAX(thread_list->z_max, zidx);
+			}
+
 			if (r_z_last_list[zidx]) {
 				r_z_last_list[zidx]->next = ci;
 				r_z_last_list[zidx] = ci;
@@ -214,7 +227,9 @@ void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *
 
 		if (ci->visibility_notifier) {
 			if (!ci->visibility_notifier->visible_element.in_list()) {
+				visibility_notifier_list_lock.lock();
 				visibility_notifier_list.add(&ci->visibility_notifier->visible_element);
+				visibility_notifier_list_lock.unlock();
 				ci->visibility_notifier->just_visible = true;
 			}
 
@@ -317,9 +332,16 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 			SortArray<Item *, ItemPtrSort> sorter;
 			sorter.sort(child_items, child_item_count);
 
-			for (i = 0; i < child_item_count; i++) {
-				_cull_canvas_item(child_items[i], xform * child_items[i]->ysort_xform, p_clip_rect, modulate * child_items[i]->ysort_modulate, child_items[i]->ysort_parent_abs_z_index, r_z_list, r_z_last_list, (Item *)ci->final_clip_owner, (Item *)child_items[i]->material_owner, false, canvas_cull_mask);
-			}
+			ThreadedCullData cull_data;
+			cull_data.items = child_items;
+			cull_data.item_count = child_item_count;
+			cull_data.y_sorted = true;
+			cull_data.xform = xform;
+			cull_data.clip_rect = p_clip_rect;
+			cull_data.modulate = modulate;
+			cull_data.canvas_clip = (Item *)ci->final_clip_owner;
+			cull_data.canvas_cull_mask = canvas_cull_mask;
+			_cull_canvas_item_children(cull_data, r_z_list, r_z_last_list);
 		} else {
 			RendererCanvasRender::Item *canvas_group_from = nullptr;
 			bool use_canvas_group = ci->canvas_group != nullptr && (ci->canvas_group->fit_empty || ci->commands != nullptr);
@@ -338,6 +360,47 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 			canvas_group_from = r_z_last_list[zidx];
 		}
 
+		if (!thread_cull_active && (uint32_t)child_item_count >= thread_cull_threshold) {
+			// Same order as below: children drawn behind this item, this item, then the rest.
+			ThreadedCullData cull_data;
+			cull_data.items = child_items;
+			cull_data.item_count = child_item_count;
+			cull_data.xform = xform;
+			cull_data.clip_rect = p_clip_rect;
+			cull_data.modulate = modulate;
+			cull_data.z = p_z;
+			cull_data.canvas_clip = (Item *)ci->final_clip_owner;
+			cull_data.material_owner = p_material_owner;
+			cull_data.canvas_cull_mask = canvas_cull_mask;
+
+			if (use_canvas_group) {
+				_cull_canvas_item_children(cull_data, r_z_list, r_z_last_list);
+				_attach_canvas_item_for_draw(ci, p_canvas_clip, r_z_list, r_z_last_list, xform, p_clip_rect, global_rect, modulate, p_z, p_material_owner, use_canvas_group, canvas_group_from, xform);
+				return;
+			}
+
+			uint32_t behind_count = 0;
+			for (int i = 0; i < child_item_count; i++) {
+				if (child_items[i]->behind) {
+					behind_count++;
+				}
+			}
+			if (behind_count >= thread_cull_threshold) {
+				cull_data.filter = ThreadedCullData::FILTER_BEHIND;
+				_cull_canvas_item_children(cull_data, r_z_list, r_z_last_list);
+			} else if (behind_count > 0) {
+				for (int i = 0; i < child_item_count; i++) {
+					if (child_items[i]->behind) {
+						_cull_canvas_item(child_items[i], xform, p_clip_rect, modulate, p_z, r_z_list, r_z_last_list, (Item *)ci->final_clip_owner, p_material_owner, true, canvas_cull_mask);
+					}
+				}
+			}
+			_attach_canvas_item_for_draw(ci, p_canvas_clip, r_z_list, r_z_last_list, xform, p_clip_rect, global_rect, modulate, p_z, p_material_owner, use_canvas_group, canvas_group_from, xform);
+			cull_data.filter = ThreadedCullData::FILTER_IN_FRONT;
+			_cull_canvas_item_children(cull_data, r_z_list, r_z_last_list);
+			return;
+		}
+
 		for (int i = 0; i < child_item_count; i++) {
 			if (!child_items[i]->behind && !use_canvas_group) {
 				continue;
@@ -354,6 +417,85 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 	}
 }
 
+thread_local RendererCanvasCull::ThreadedCullList *RendererCanvasCull::current_thread_cull_list = nullptr;
+
+void RendererCanvasCull::_cull_canvas_item_children_range(const ThreadedCullData &p_data, uint32_t p_from, uint32_t p_to, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list) {
+	for (uint32_t i = p_from; i < p_to; i++) {
+		Item *child = p_data.items[i];
+		if (p_data.filter != ThreadedCullData::FILTER_ALL && child->behind != (p_data.filter == ThreadedCullData::FILTER_BEHIND)) {
+			continue;
+		}
+		if (p_data.y_sorted) {
+			_cull_canvas_item(child, p_data.xform * child->ysort_xform, p_data.clip_rect, p_data.modulate * child->ysort_modulate, child->ysort_parent_abs_z_index, r_z_list, r_z_last_list, p_data.canvas_clip, (Item *)child->material_owner, false, p_data.canvas_cull_mask);
+		} else {
+			_cull_canvas_item(child, p_data.xform, p_data.clip_rect, p_data.modulate, p_data.z, r_z_list, r_z_last_list, p_data.canvas_clip, p_data.material_owner, true, p_data.canvas_cull_mask);
+		}
+	}
+}
+
+void RendererCanvasCull::_cull_canvas_item_children_threaded(uint32_t p_thread, ThreadedCullData *p_data) {
+	uint32_t from = p_thread * p_data->item_count / p_data->thread_count;
+	uint32_t to = (p_thread + 1) * p_data->item_count / p_data->thread_count;
+
+	ThreadedCullList &list = thread_cull_lists[p_thread];
+	current_thread_cull_list = &list;
+	_cull_canvas_item_children_range(*p_data, from, to, list.z_list, list.z_last_list);
+	current_thread_cull_list = nullptr;
+}
+
+void RendererCanvasCull::_cull_canvas_item_children(ThreadedCullData &p_data, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list) {
+	if (thread_cull_active || p_data.item_count < thread_cull_threshold) {
+		_cull_canvas_item_children_range(p_data, 0, p_data.item_count, r_z_list, r_z_last_list);
+		return;
+	}
+
+	if (thread_cull_lists.is_empty()) {
+		thread_cull_lists.resize(WorkerThreadPool::get_singleton()->get_thread_count());
+		for (ThreadedCullList &list : thread_cull_lists) {
+			list.z_list = (RendererCanvasRender::Item **)memalloc(z_range * sizeof(RendererCanvasRender::Item *));
+			list.z_last_list = (RendererCanvasRender::Item **)memalloc(z_range * sizeof(RendererCanvasRender::Item *));
+			memset(list.z_list, 0, z_range * sizeof(RendererCanvasRender::Item *));
+			memset(list.z_last_list, 0, z_range * sizeof(RendererCanvasRender::Item *));
+		}
+	}
+
+	p_data.thread_count = MIN(thread_cull_lists.size(), p_data.item_count);
+
+	// Nested subtrees are culled serially by the worker that owns them.
+	thread_cull_active = true;
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &RendererCanvasCull::_cull_canvas_item_children_threaded, &p_data, p_data.thread_count, -1, true, SNAME("CanvasCullItems"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	thread_cull_active = false;
+
+	// Append each thread's lists in item order, so the result matches a serial cull.
+	int z_min = z_range;
+	int z_max = -1;
+	for (uint32_t j = 0; j < p_data.thread_count; j++) {
+		z_min = MIN(z_min, thread_cull_lists[j].z_min);
+		z_max = MAX(z_max, thread_cull_lists[j].z_max);
+	}
+	for (int i = z_min; i <= z_max; i++) {
+		for (uint32_t j = 0; j < p_data.thread_count; j++) {
+			ThreadedCullList &list = thread_cull_lists[j];
+			if (!list.z_list[i]) {
+				continue;
+			}
+			if (r_z_last_list[i]) {
+				r_z_last_list[i]->next = list.z_list[i];
+			} else {
+				r_z_list[i] = list.z_list[i];
+			}
+			r_z_last_list[i] = list.z_last_list[i];
+			list.z_list[i] = nullptr;
+			list.z_last_list[i] = nullptr;
+		}
+	}
+	for (uint32_t j = 0; j < p_data.thread_count; j++) {
+		thread_cull_lists[j].z_min = z_range;
+		thread_cull_lists[j].z_max = -1;
+	}
+}
+
 void RendererCanvasCull::render_canvas(RID p_render_target, Canvas *p_canvas, const Transform2D &p_transform, RendererCanvasRender::Light *p_lights, RendererCanvasRender::Light *p_directional_lights, const Rect2 &p_clip_rect, RenderingServer::CanvasItemTextureFilter p_default_filter, RenderingServer::CanvasItemTextureRepeat p_default_repeat, bool p_snap_2d_transforms_to_pixel, bool p_snap_2d_vertices_to_pixel, uint32_t canvas_cull_mask) {
 	RENDER_TIMESTAMP("> Render Canvas");
 
@@ -2166,6 +2308,8 @@ RendererCanvasCull::RendererCanvasCull() {
 	z_last_list = (RendererCanvasRender::Item **)memalloc(z_range * sizeof(RendererCanvasRender::Item *));
 
 	disable_scale = false;
+	thread_cull_threshold = GLOBAL_GET("rendering/limits/canvas/threaded_cull_minimum_children");
+	thread_cull_threshold = MAX(thread_cull_threshold, 2u);
 
 	debug_redraw_time = GLOBAL_DEF("debug/canvas_items/debug_redraw_time", 1.0);
 	debug_redraw_color = GLOBAL_DEF("debug/canvas_items/debug_redraw_color", Color(1.0, 0.2, 0.2, 0.5));
@@ -2174,4 +2318,8 @@ RendererCanvasCull::RendererCanvasCull() {
 RendererCanvasCull::~RendererCanvasCull() {
 	memfree(z_list);
 	memfree(z_last_list);
+	for (ThreadedCullList &list : thread_cull_lists) {
+		memfree(list.z_list);
+		memfree(list.z_last_list);
+	}
 }
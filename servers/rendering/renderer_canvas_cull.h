@@ -31,11 +31,15 @@
 #ifndef RENDERER_CANVAS_CULL_H
 #define RENDERER_CANVAS_CULL_H
 
+#include "core/os/spin_lock.h"
 #include "core/templates/paged_allocator.h"
+#include "core/templates/safe_refcount.h"
 #include "renderer_compositor.h"
 #include "renderer_viewport.h"
 
 class RendererCanvasCull {
+	friend class TestRendererCanvasCullAccessor;
+
 public:
 	struct Item : public RendererCanvasRender::Item {
 		RID parent; // canvas it belongs to
@@ -180,6 +184,8 @@ public:
 
 	PagedAllocator<Item::VisibilityNotifierData> visibility_notifier_allocator;
 	SelfList<Item::VisibilityNotifierData>::List visibility_notifier_list;
+	SpinLock visibility_notifier_list_lock;
+	SafeFlag cull_redraw_requested;
 
 	_FORCE_INLINE_ void _attach_canvas_item_for_draw(Item *ci, Item *p_canvas_clip, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, const Transform2D &xform, const Rect2 &p_clip_rect, Rect2 global_rect, const Color &modulate, int p_z, RendererCanvasCull::Item *p_material_owner, bool p_use_canvas_group, RendererCanvasRender::Item *canvas_group_from, const Transform2D &p_xform);
 
@@ -189,6 +195,48 @@ private:
 
 	static constexpr int z_range = RS::CANVAS_ITEM_Z_MAX - RS::CANVAS_ITEM_Z_MIN + 1;
 
+	// Sibling subtrees never share items, so they can be culled on worker threads into
+	// separate z lists. Those are then appended in sibling order, which yields exactly the
+	// same draw order as culling them one after another.
+	struct ThreadedCullData {
+		enum Filter {
+			FILTER_ALL,
+			FILTER_BEHIND,
+			FILTER_IN_FRONT,
+		};
+
+		Item **items = nullptr;
+		uint32_t item_count = 0;
+		Filter filter = FILTER_ALL; // Children drawn behind their parent are culled in a separate pass.
+		bool y_sorted = false;
+		Transform2D xform;
+		Rect2 clip_rect;
+		Color modulate;
+		int z = 0;
+		Item *canvas_clip = nullptr;
+		Item *material_owner = nullptr;
+		uint32_t canvas_cull_mask = 0;
+		uint32_t thread_count = 0;
+	};
+
+	// Lists are kept cleared between uses, so only the z indices that were used need to be
+	// merged and cleared again.
+	struct ThreadedCullList {
+		RendererCanvasRender::Item **z_list = nullptr;
+		RendererCanvasRender::Item **z_last_list = nullptr;
+		int z_min = z_range;
+		int z_max = -1;
+	};
+
+	static thread_local ThreadedCullList *current_thread_cull_list;
+	LocalVector<ThreadedCullList> thread_cull_lists;
+	uint32_t thread_cull_threshold = 256;
+	bool thread_cull_active = false;
+
+	void _cull_canvas_item_children(ThreadedCullData &p_data, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list);
+	void _cull_canvas_item_children_range(const ThreadedCullData &p_data, uint32_t p_from, uint32_t p_to, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list);
+	void _cull_canvas_item_children_threaded(uint32_t p_thread, ThreadedCullData *p_data);
+
 	RendererCanvasRender::Item **z_list;
 	RendererCanvasRender::Item **z_last_list;
 
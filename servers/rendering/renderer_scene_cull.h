@@ -241,6 +241,54 @@ public:
 		}
 	};
 
+	struct InstanceBoundsBlock {
+		// Bounds of consecutive instances in structure-of-arrays layout.
+		// Testing a whole block plane by plane lets the compiler vectorize
+		// the frustum check across instances.
+
+		static constexpr uint32_t SIZE = 64;
+
+		real_t bounds[6][SIZE] = {};
+		uint32_t count = 0;
+
+		// Only the bounds of instances set in p_mask are loaded, the others keep stale values
+		// and their bits must be ignored in the result.
+		_ALWAYS_INLINE_ void load(const PagedArray<InstanceBounds> &p_instance_aabbs, uint64_t p_from, uint32_t p_count, uint64_t p_mask = UINT64_MAX) {
+			count = p_count;
+			for (uint32_t i = 0; i < p_count; i++) {
+				if (!((p_mask >> i) & 1)) {
+					continue;
+				}
+				const InstanceBounds &ib = p_instance_aabbs[p_from + i];
+				for (uint32_t j = 0; j < 6; j++) {
+					bounds[j][i] = ib.bounds[j];
+				}
+			}
+		}
+
+		// Same test as InstanceBounds::in_frustum(), one bit per instance in the block.
+		_ALWAYS_INLINE_ uint64_t in_frustum_mask(const Frustum &p_frustum) const {
+			uint8_t outside[SIZE] = {};
+
+			for (uint32_t i = 0; i < p_frustum.plane_count; i++) {
+				const Plane &plane = p_frustum.planes_ptr[i];
+				const real_t *x = bounds[p_frustum.plane_signs_ptr[i].signs[0]];
+				const real_t *y = bounds[p_frustum.plane_signs_ptr[i].signs[1]];
+				const real_t *z = bounds[p_frustum.plane_signs_ptr[i].signs[2]];
+
+				for (uint32_t j = 0; j < count; j++) {
+					outside[j] |= (plane.normal.x * x[j] + plane.normal.y * y[j] + plane.normal.z * z[j] - plane.d) >= (real_t)0.0;
+				}
+			}
+
+			uint64_t mask = 0;
+			for (uint32_t j = 0; j < count; j++) {
+				mask |= uint64_t(outside[j] == 0) << j;
+			}
+			return mask;
+		}
+	};
+
 	struct InstanceVisibilityNotifierData;
 
 	struct InstanceData {
@@ -964,6 +1012,7 @@ public:
 	virtual void instance_set_layer_mask(RID p_instance, uint32_t p_mask);
 	virtual void instance_set_pivot_data(RID p_instance, float p_sorting_offset, bool p_use_aabb_center);
 	virtual void instance_set_transform(RID p_instance, const Transform3D &p_transform);
+	virtual void instance_set_transforms(const Vector<RID> &p_instances, const Vector<Transform3D> &p_transforms);
 	virtual void instance_attach_object_instance_id(RID p_instance, ObjectID p_id);
 	virtual void instance_set_blend_shape_weight(RID p_instance, int p_shape, float p_weight);
 	virtual void instance_set_surface_override_material(RID p_instance, int p_surface, RID p_material);
@@ -30,6 +30,7 @@
 
 #include "shader_compiler.h"
 
+#include "core/config/engine.h"
 #include "core/config/project_settings.h"
 #include "core/os/os.h"
 #include "servers/rendering/rendering_server_globals.h"
@@ -900,6 +901,7 @@ String ShaderCompiler::_dump_node_code(const SL::Node *p_node, int p_level, Gene
 
 			if (p_assigning && p_actions.write_flag_pointers.has(vnode->name)) {
 				*p_actions.write_flag_pointers[vnode->name] = true;
+				written_flag_pointers.insert(vnode->name);
 			}
 
 			if (p_default_actions.usage_defines.has(vnode->name) && !used_name_defines.has(vnode->name)) {
@@ -1017,6 +1019,7 @@ String ShaderCompiler::_dump_node_code(const SL::Node *p_node, int p_level, Gene
 
 			if (p_assigning && p_actions.write_flag_pointers.has(anode->name)) {
 				*p_actions.write_flag_pointers[anode->name] = true;
+				written_flag_pointers.insert(anode->name);
 			}
 
 			if (p_default_actions.usage_defines.has(anode->name) && !used_name_defines.has(anode->name)) {
@@ -1231,6 +1234,7 @@ String ShaderCompiler::_dump_node_code(const SL::Node *p_node, int p_level, Gene
 
 							if (found && p_actions.write_flag_pointers.has(name)) {
 								*p_actions.write_flag_pointers[name] = true;
+								written_flag_pointers.insert(name);
 							}
 						}
 
@@ -1453,6 +1457,10 @@ ShaderLanguage::DataType ShaderCompiler::_get_global_shader_uniform_type(const S
 }
 
 Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code) {
+	if (_compile_from_cache(p_mode, p_code, p_actions, r_gen_code)) {
+		return OK;
+	}
+
 	SL::ShaderCompileInfo info;
 	info.functions = ShaderTypes::get_singleton()->get_functions(p_mode);
 	info.render_modes = ShaderTypes::get_singleton()->get_modes(p_mode);
@@ -1551,17 +1559,81 @@ Error ShaderCompiler::compile(RS::ShaderMode p_mode, const String &p_code, Ident
 	used_name_defines.clear();
 	used_rmode_defines.clear();
 	used_flag_pointers.clear();
+	written_flag_pointers.clear();
 	fragment_varyings.clear();
 
+	bool cacheable = p_actions->uniforms->is_empty();
+
 	shader = parser.get_shader();
 	function = nullptr;
 	_dump_node_code(shader, 1, r_gen_code, *p_actions, actions, false);
 
+	if (cacheable) {
+		CompileCacheEntry entry;
+		entry.mode = p_mode;
+		entry.gen_code = r_gen_code;
+		entry.uniforms = *p_actions->uniforms;
+		entry.render_modes = shader->render_modes;
+		entry.usage_flags.clear();
+		for (const StringName &E : used_flag_pointers) {
+			entry.usage_flags.push_back(E);
+		}
+		entry.write_flags.clear();
+		for (const StringName &E : written_flag_pointers) {
+			entry.write_flags.push_back(E);
+		}
+		compile_cache.insert(p_code, entry);
+	}
+
 	return OK;
 }
 
+bool ShaderCompiler::_compile_from_cache(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, GeneratedCode &r_gen_code) {
+	const CompileCacheEntry *entry = compile_cache.getptr(p_code);
+	if (!entry || entry->mode != p_mode || !p_actions->uniforms->is_empty()) {
+		return false;
+	}
+
+	if (Engine::get_singleton()->is_editor_hint()) {
+		// Global uniforms are validated in the editor, and may have changed since.
+		for (const KeyValue<StringName, SL::ShaderNode::Uniform> &E : entry->uniforms) {
+			if (E.value.scope == SL::ShaderNode::Uniform::SCOPE_GLOBAL && _get_global_shader_uniform_type(E.key) != E.value.type) {
+				return false;
+			}
+		}
+	}
+
+	// Reproduce the side effects compiling the code had on the identifier actions.
+	for (const StringName &E : entry->render_modes) {
+		if (p_actions->render_mode_flags.has(E)) {
+			*p_actions->render_mode_flags[E] = true;
+		}
+		if (p_actions->render_mode_values.has(E)) {
+			Pair<int *, int> &p = p_actions->render_mode_values[E];
+			*p.first = p.second;
+		}
+	}
+	for (const StringName &E : entry->usage_flags) {
+		if (p_actions->usage_flag_pointers.has(E)) {
+			*p_actions->usage_flag_pointers[E] = true;
+		}
+	}
+	for (const StringName &E : entry->write_flags) {
+		if (p_actions->write_flag_pointers.has(E)) {
+			*p_actions->write_flag_pointers[E] = true;
+		}
+	}
+	for (const KeyValue<StringName, SL::ShaderNode::Uniform> &E : entry->uniforms) {
+		p_actions->uniforms->insert(E.key, E.value);
+	}
+
+	r_gen_code = entry->gen_code;
+	return true;
+}
+
 void ShaderCompiler::initialize(DefaultIdentifierActions p_actions) {
 	actions = p_actions;
+	compile_cache.clear();
 
 	time_name = "TIME";
 
@@ -1586,4 +1658,5 @@ void ShaderCompiler::initialize(DefaultIdentifierActions p_actions) {
 }
 
 ShaderCompiler::ShaderCompiler() {
+	compile_cache.set_capacity(COMPILE_CACHE_MAX_ENTRIES);
 }
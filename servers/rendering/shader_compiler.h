@@ -31,11 +31,14 @@
 #ifndef SHADER_COMPILER_H
 #define SHADER_COMPILER_H
 
+#include "core/templates/lru.h"
 #include "core/templates/pair.h"
 #include "servers/rendering/shader_language.h"
 #include "servers/rendering_server.h"
 
 class ShaderCompiler {
+	friend class TestShaderCompilerAccessor;
+
 public:
 	enum Stage {
 		STAGE_VERTEX,
@@ -119,6 +122,7 @@ private:
 
 	HashSet<StringName> used_name_defines;
 	HashSet<StringName> used_flag_pointers;
+	HashSet<StringName> written_flag_pointers;
 	HashSet<StringName> used_rmode_defines;
 	HashSet<StringName> internal_functions;
 	HashSet<StringName> fragment_varyings;
@@ -127,6 +131,24 @@ private:
 
 	static ShaderLanguage::DataType _get_global_shader_uniform_type(const StringName &p_name);
 
+	// Successful compilations, keyed by shader code. The same code always compiles
+	// to the same result with a given compiler, so setting it again (on another
+	// shader, or when restoring it in the editor) skips parsing and code generation.
+	struct CompileCacheEntry {
+		RS::ShaderMode mode = RS::SHADER_MAX;
+		GeneratedCode gen_code;
+		HashMap<StringName, ShaderLanguage::ShaderNode::Uniform> uniforms;
+		Vector<StringName> render_modes;
+		LocalVector<StringName> usage_flags;
+		LocalVector<StringName> write_flags;
+	};
+
+	// Once full, the least recently compiled code is evicted.
+	static const uint32_t COMPILE_CACHE_MAX_ENTRIES = 256;
+	LRUCache<String, CompileCacheEntry> compile_cache;
+
+	bool _compile_from_cache(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, GeneratedCode &r_gen_code);
+
 public:
 	Error compile(RS::ShaderMode p_mode, const String &p_code, IdentifierActions *p_actions, const String &p_path, GeneratedCode &r_gen_code);
 
@@ -89,6 +89,33 @@ PackedInt64Array RenderingServer::_instances_cull_aabb_bind(const AABB &p_aabb,
 	return to_int_array(ids);
 }
 
+void RenderingServer::_instance_set_transforms_bind(const PackedInt64Array &p_instances, const PackedFloat32Array &p_buffer) {
+	ERR_FAIL_COND_MSG(p_buffer.size() != p_instances.size() * 12, "The transform buffer must contain 12 floats per instance.");
+
+	Vector<RID> instances;
+	Vector<Transform3D> transforms;
+	instances.resize(p_instances.size());
+	transforms.resize(p_instances.size());
+
+	const int64_t *r_ids = p_instances.ptr();
+	const float *r_buffer = p_buffer.ptr();
+	RID *w_instances = instances.ptrw();
+	Transform3D *w_transforms = transforms.ptrw();
+	for (int i = 0; i < p_instances.size(); i++) {
+		w_instances[i] = RID::from_uint64(r_ids[i]);
+
+		// Same layout as multimesh_set_buffer().
+		const float *data = &r_buffer[i * 12];
+		Transform3D &xform = w_transforms[i];
+		xform.basis.rows[0] = Vector3(data[0], data[1], data[2]);
+		xform.basis.rows[1] = Vector3(data[4], data[5], data[6]);
+		xform.basis.rows[2] = Vector3(data[8], data[9], data[10]);
+		xform.origin = Vector3(data[3], data[7], data[11]);
+	}
+
+	instance_set_transforms(instances, transforms);
+}
+
 PackedInt64Array RenderingServer::_instances_cull_ray_bind(const Vector3 &p_from, const Vector3 &p_to, RID p_scenario) const {
 	if (RSG::threaded) {
 		WARN_PRINT_ONCE("Using this function with a threaded renderer hurts performance, as it causes a server stall.");
@@ -3048,6 +3075,7 @@ void RenderingServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("instance_set_layer_mask", "instance", "mask"), &RenderingServer::instance_set_layer_mask);
 	ClassDB::bind_method(D_METHOD("instance_set_pivot_data", "instance", "sorting_offset", "use_aabb_center"), &RenderingServer::instance_set_pivot_data);
 	ClassDB::bind_method(D_METHOD("instance_set_transform", "instance", "transform"), &RenderingServer::instance_set_transform);
+	ClassDB::bind_method(D_METHOD("instance_set_transforms", "instances", "buffer"), &RenderingServer::_instance_set_transforms_bind);
 	ClassDB::bind_method(D_METHOD("instance_attach_object_instance_id", "instance", "id"), &RenderingServer::instance_attach_object_instance_id);
 	ClassDB::bind_method(D_METHOD("instance_set_blend_shape_weight", "instance", "shape", "weight"), &RenderingServer::instance_set_blend_shape_weight);
 	ClassDB::bind_method(D_METHOD("instance_set_surface_override_material", "instance", "surface", "material"), &RenderingServer::instance_set_surface_override_material);
@@ -3533,6 +3561,16 @@ void RenderingServer::init() {
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/lightmapping/probe_capture/update_speed", PROPERTY_HINT_RANGE, "0.001,256,0.001"), 15);
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/lightmapping/primitive_meshes/texel_size", PROPERTY_HINT_RANGE, "0.001,100,0.001"), 0.2);
 
+	// Shared by the GPU and CPU lightmappers, so both backends bake comparable quality levels.
+	GLOBAL_DEF("rendering/lightmapping/bake_quality/low_quality_ray_count", 32);
+	GLOBAL_DEF("rendering/lightmapping/bake_quality/medium_quality_ray_count", 128);
+	GLOBAL_DEF("rendering/lightmapping/bake_quality/high_quality_ray_count", 512);
+	GLOBAL_DEF("rendering/lightmapping/bake_quality/ultra_quality_ray_count", 2048);
+	GLOBAL_DEF("rendering/lightmapping/bake_quality/low_quality_probe_ray_count", 64);
+	GLOBAL_DEF("rendering/lightmapping/bake_quality/medium_quality_probe_ray_count", 256);
+	GLOBAL_DEF("rendering/lightmapping/bake_quality/high_quality_probe_ray_count", 512);
+	GLOBAL_DEF("rendering/lightmapping/bake_quality/ultra_quality_probe_ray_count", 2048);
+
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/global_illumination/sdfgi/probe_ray_count", PROPERTY_HINT_ENUM, "8 (Fastest),16,32,64,96,128 (Slowest)"), 1);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/global_illumination/sdfgi/frames_to_converge", PROPERTY_HINT_ENUM, "5 (Less Latency but Lower Quality),10,15,20,25,30 (More Latency but Higher Quality)"), 5);
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "rendering/global_illumination/sdfgi/frames_to_update_lights", PROPERTY_HINT_ENUM, "1 (Slower),2,4,8,16 (Faster)"), 2);
@@ -3544,6 +3582,7 @@ void RenderingServer::init() {
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/limits/spatial_indexer/update_iterations_per_frame", PROPERTY_HINT_RANGE, "0,1024,1"), 10);
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/limits/spatial_indexer/threaded_cull_minimum_instances", PROPERTY_HINT_RANGE, "32,65536,1"), 1000);
 	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/limits/forward_renderer/threaded_render_minimum_instances", PROPERTY_HINT_RANGE, "32,65536,1"), 500);
+	GLOBAL_DEF_RST(PropertyInfo(Variant::INT, "rendering/limits/canvas/threaded_cull_minimum_children", PROPERTY_HINT_RANGE, "32,65536,1"), 256);
 
 	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "rendering/limits/cluster_builder/max_clustered_elements", PROPERTY_HINT_RANGE, "32,8192,1"), 512);
 
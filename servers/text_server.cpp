@@ -416,6 +416,7 @@ void TextServer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("shaped_text_tab_align", "shaped", "tab_stops"), &TextServer::shaped_text_tab_align);
 
 	ClassDB::bind_method(D_METHOD("shaped_text_shape", "shaped"), &TextServer::shaped_text_shape);
+	ClassDB::bind_method(D_METHOD("shaped_text_shape_batch", "shaped"), &TextServer::shaped_text_shape_batch);
 	ClassDB::bind_method(D_METHOD("shaped_text_is_ready", "shaped"), &TextServer::shaped_text_is_ready);
 	ClassDB::bind_method(D_METHOD("shaped_text_has_visible_chars", "shaped"), &TextServer::shaped_text_has_visible_chars);
 
@@ -979,6 +980,14 @@ PackedInt32Array TextServer::shaped_text_get_line_breaks(const RID &p_shaped, do
 	return lines;
 }
 
+bool TextServer::shaped_text_shape_batch(const TypedArray<RID> &p_shaped) {
+	bool ret = true;
+	for (int i = 0; i < p_shaped.size(); i++) {
+		ret = shaped_text_shape(p_shaped[i]) && ret;
+	}
+	return ret;
+}
+
 PackedInt32Array TextServer::shaped_text_get_word_breaks(const RID &p_shaped, BitField<TextServer::GraphemeFlag> p_grapheme_flags) const {
 	PackedInt32Array words;
 
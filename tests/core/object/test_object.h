@@ -35,6 +35,8 @@
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
 
 #include "tests/test_macros.h"
 
@@ -58,6 +60,13 @@ public:
 	int get_property() const { return property_value; }
 };
 
+class _TestFurtherDerivedObject : public _TestDerivedObject {
+	GDCLASS(_TestFurtherDerivedObject, _TestDerivedObject);
+
+protected:
+	static void _bind_methods() {}
+};
+
 namespace TestObject {
 
 class _MockScriptInstance : public ScriptInstance {
@@ -240,6 +249,64 @@ TEST_CASE("[Object] Built-in property getter") {
 			"The returned value should equal the one which was set with built-in setter.");
 }
 
+TEST_CASE("[Object] Inherited property lookup") {
+	GDREGISTER_CLASS(_TestDerivedObject);
+	GDREGISTER_CLASS(_TestFurtherDerivedObject);
+	_TestFurtherDerivedObject object;
+
+	bool valid = false;
+	object.set("property", 42, &valid);
+	CHECK(valid);
+	CHECK(object.get_property() == 42);
+	CHECK(int(object.get("property", &valid)) == 42);
+	CHECK(valid);
+
+	SUBCASE("Properties registered after the lookup was built should be found") {
+		if (!ClassDB::has_property("_TestFurtherDerivedObject", "property_alias", true)) {
+			Variant value;
+			CHECK_FALSE(ClassDB::get_property(&object, "property_alias", value));
+			ClassDB::add_property("_TestFurtherDerivedObject", PropertyInfo(Variant::INT, "property_alias"), "set_property", "get_property");
+		}
+
+		CHECK(ClassDB::set_property(&object, "property_alias", 7, &valid));
+		CHECK(valid);
+		CHECK(object.get_property() == 7);
+	}
+}
+
+struct PropertyLookupThreadData {
+	int rounds = 0;
+	SafeNumeric<uint32_t> failures;
+};
+
+static void property_lookup_thread_task(void *p_userdata, uint32_t p_index) {
+	PropertyLookupThreadData *data = (PropertyLookupThreadData *)p_userdata;
+	_TestFurtherDerivedObject object;
+	for (int i = 0; i < data->rounds; i++) {
+		if (p_index == 0 && i % 10 == 0) {
+			// Keep replacing the tables while the other threads read them.
+			ClassDB::_invalidate_property_lookups();
+		}
+		Variant value;
+		if (!ClassDB::set_property(&object, "property", i) || !ClassDB::get_property(&object, "property", value) || int(value) != i) {
+			data->failures.increment();
+		}
+	}
+}
+
+TEST_CASE("[Object] Inherited property lookup from multiple threads") {
+	GDREGISTER_CLASS(_TestDerivedObject);
+	GDREGISTER_CLASS(_TestFurtherDerivedObject);
+
+	PropertyLookupThreadData data;
+	data.rounds = 10000;
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(property_lookup_thread_task, &data, 8, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	CHECK_MESSAGE(data.failures.get() == 0, "Properties should be accessible while lookup tables are being replaced.");
+}
+
 TEST_CASE("[Object] Script property setter") {
 	Object object;
 	Variant script;
@@ -284,6 +351,21 @@ TEST_CASE("[Object] Absent name getter") {
 			"The returned value should equal nil variant.");
 }
 
+class _SignalCounter : public Object {
+public:
+	int count = 0;
+	Object *emitter = nullptr;
+	_SignalCounter *connect_on_emit = nullptr;
+
+	void on_signal() {
+		count++;
+		if (connect_on_emit) {
+			emitter->connect("my_custom_signal", callable_mp(connect_on_emit, &_SignalCounter::on_signal));
+			connect_on_emit = nullptr;
+		}
+	}
+};
+
 TEST_CASE("[Object] Signals") {
 	Object object;
 
@@ -402,6 +484,40 @@ TEST_CASE("[Object] Signals") {
 		SIGNAL_UNWATCH(&object, "my_custom_signal");
 	}
 
+	SUBCASE("Connections made during emission should only be called by later emissions") {
+		_SignalCounter first;
+		_SignalCounter second;
+		first.emitter = &object;
+		first.connect_on_emit = &second;
+
+		object.connect("my_custom_signal", callable_mp(&first, &_SignalCounter::on_signal));
+
+		object.emit_signal("my_custom_signal");
+		CHECK(first.count == 1);
+		CHECK(second.count == 0);
+
+		object.emit_signal("my_custom_signal");
+		CHECK(first.count == 2);
+		CHECK(second.count == 1);
+
+		object.disconnect("my_custom_signal", callable_mp(&first, &_SignalCounter::on_signal));
+		object.emit_signal("my_custom_signal");
+		CHECK(first.count == 2);
+		CHECK(second.count == 2);
+
+		object.disconnect("my_custom_signal", callable_mp(&second, &_SignalCounter::on_signal));
+	}
+
+	SUBCASE("One-shot connections should only be called once") {
+		_SignalCounter counter;
+		object.connect("my_custom_signal", callable_mp(&counter, &_SignalCounter::on_signal), Object::CONNECT_ONE_SHOT);
+
+		object.emit_signal("my_custom_signal");
+		object.emit_signal("my_custom_signal");
+		CHECK(counter.count == 1);
+		CHECK_FALSE(object.is_connected("my_custom_signal", callable_mp(&counter, &_SignalCounter::on_signal)));
+	}
+
 	SUBCASE("Connecting and then disconnecting many signals should not leave anything behind") {
 		List<Object::Connection> signal_connections;
 		Object targets[100];
@@ -494,6 +610,151 @@ TEST_CASE("[Object] Notification order") { // GH-52325
 	memdelete(test_notification_object);
 }
 
+struct ObjectDBThreadData {
+	int objects_per_task = 0;
+	int rounds = 0;
+	SafeNumeric<uint32_t> failures;
+};
+
+static void object_db_thread_task(void *p_userdata, uint32_t p_index) {
+	ObjectDBThreadData *data = (ObjectDBThreadData *)p_userdata;
+	LocalVector<Object *> objects;
+	LocalVector<ObjectID> ids;
+	objects.resize(data->objects_per_task);
+	ids.resize(data->objects_per_task);
+
+	for (int round = 0; round < data->rounds; round++) {
+		for (int i = 0; i < data->objects_per_task; i++) {
+			objects[i] = memnew(Object);
+			ids[i] = objects[i]->get_instance_id();
+		}
+		for (int i = 0; i < data->objects_per_task; i++) {
+			if (ObjectDB::get_instance(ids[i]) != objects[i]) {
+				data->failures.increment();
+			}
+		}
+		for (int i = 0; i < data->objects_per_task; i++) {
+			memdelete(objects[i]);
+			if (ObjectDB::get_instance(ids[i]) != nullptr) {
+				data->failures.increment();
+			}
+		}
+	}
+}
+
+TEST_CASE("[Object] ObjectDB from multiple threads") {
+	const int object_count = ObjectDB::get_object_count();
+
+	ObjectDBThreadData data;
+	data.objects_per_task = 1000;
+	data.rounds = 10;
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(object_db_thread_task, &data, 16, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	CHECK_MESSAGE(data.failures.get() == 0, "Objects should be found by their IDs until they are freed, from every thread.");
+	CHECK(ObjectDB::get_object_count() == object_count);
+}
+
+TEST_CASE("[Object] ObjectDB lookups of invalid IDs") {
+	Object object;
+
+	CHECK_MESSAGE(ObjectDB::get_instance(ObjectID()) == nullptr, "The null ID should never match an object, even if free slots store it.");
+
+	// The last slot, which is in a page that is never allocated by the tests.
+	const ObjectID unallocated = ObjectID((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) | OBJECTDB_SLOT_MAX_COUNT_MASK);
+	CHECK(ObjectDB::get_instance(unallocated) == nullptr);
+
+	// Same slot as a live object, with another validator.
+	const ObjectID stale = ObjectID(uint64_t(object.get_instance_id()) ^ (uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS));
+	CHECK(ObjectDB::get_instance(stale) == nullptr);
+	CHECK(ObjectDB::get_instance(object.get_instance_id()) == &object);
+}
+
+TEST_CASE("[Object][Benchmark] ObjectDB multi-threaded create and destroy" * doctest::skip()) {
+	ObjectDBThreadData data;
+	data.objects_per_task = 10000;
+	data.rounds = 100;
+	const uint32_t task_count = OS::get_singleton()->get_processor_count();
+
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(object_db_thread_task, &data, task_count, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+	const uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+	const double operations = double(task_count) * data.rounds * data.objects_per_task;
+	MESSAGE("Create, look up and destroy on ", task_count, " threads: ", elapsed * 1000.0 / operations, " ns per object.");
+	CHECK(data.failures.get() == 0);
+}
+
+class _ThreadedSignalCounter : public Object {
+public:
+	SafeNumeric<uint32_t> count;
+
+	void on_signal() {
+		count.increment();
+	}
+};
+
+struct SignalEmitThreadData {
+	Object *emitter = nullptr;
+	int emissions_per_task = 0;
+};
+
+static void signal_emit_thread_task(void *p_userdata, uint32_t p_index) {
+	SignalEmitThreadData *data = (SignalEmitThreadData *)p_userdata;
+	for (int i = 0; i < data->emissions_per_task; i++) {
+		data->emitter->emit_signal("my_custom_signal");
+	}
+}
+
+TEST_CASE("[Object] Signals emitted from multiple threads") {
+	Object object;
+	object.add_user_signal(MethodInfo("my_custom_signal"));
+
+	_ThreadedSignalCounter counters[4];
+	for (_ThreadedSignalCounter &counter : counters) {
+		object.connect("my_custom_signal", callable_mp(&counter, &_ThreadedSignalCounter::on_signal));
+	}
+
+	// The connections were just changed, so the emitting threads race to rebuild the snapshot.
+	SignalEmitThreadData data;
+	data.emitter = &object;
+	data.emissions_per_task = 1000;
+
+	const uint32_t task_count = 16;
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(signal_emit_thread_task, &data, task_count, -1, true);
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	for (_ThreadedSignalCounter &counter : counters) {
+		CHECK_MESSAGE(counter.count.get() == task_count * data.emissions_per_task, "Every emission should reach every connection.");
+	}
+}
+
+TEST_CASE("[Object][Benchmark] Signal emission" * doctest::skip()) {
+	const int emissions = 1000000;
+
+	for (int connection_count : { 1, 8, 64 }) {
+		Object object;
+		object.add_user_signal(MethodInfo("my_custom_signal"));
+
+		LocalVector<_SignalCounter> counters;
+		counters.resize(connection_count);
+		for (_SignalCounter &counter : counters) {
+			object.connect("my_custom_signal", callable_mp(&counter, &_SignalCounter::on_signal));
+		}
+
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < emissions; i++) {
+			object.emit_signal("my_custom_signal");
+		}
+		const uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+		MESSAGE("Emission to ", connection_count, " connections: ", elapsed * 1000.0 / emissions, " ns per emission.");
+		CHECK(counters[0].count == emissions);
+	}
+}
+
 } // namespace TestObject
 
 #endif // TEST_OBJECT_H
@@ -422,6 +422,119 @@ TEST_CASE("[Stress][CommandQueue] Stress test command queue") {
 	ProjectSettings::get_singleton()->set_setting(COMMAND_QUEUE_SETTING,
 			ProjectSettings::get_singleton()->property_get_revert(COMMAND_QUEUE_SETTING));
 }
+
+class ReentrantPusher {
+public:
+	CommandQueueMT *command_queue = nullptr;
+	int count = 0;
+
+	void push_another() {
+		count++;
+		command_queue->push(this, &ReentrantPusher::increment);
+	}
+	void increment() {
+		count++;
+	}
+};
+
+TEST_CASE("[CommandQueue] Commands pushed while flushing run on the next flush") {
+	CommandQueueMT command_queue(false);
+	ReentrantPusher pusher;
+	pusher.command_queue = &command_queue;
+
+	command_queue.push(&pusher, &ReentrantPusher::push_another);
+	command_queue.flush_all();
+	CHECK_MESSAGE(pusher.count == 1,
+			"Only the command pushed before the flush should have run.");
+
+	command_queue.flush_if_pending();
+	CHECK_MESSAGE(pusher.count == 2,
+			"The command pushed during the previous flush should have been kept.");
+}
+
+class NestedFlusher {
+public:
+	CommandQueueMT *command_queue = nullptr;
+	int count = 0;
+	int nested_count = 0;
+
+	void push_many_and_flush() {
+		count++;
+		// Enough commands to grow the write buffer while the outer flush is executing.
+		for (int i = 0; i < 10000; i++) {
+			command_queue->push(this, &NestedFlusher::nested_increment);
+		}
+		command_queue->flush_all();
+	}
+	void nested_increment() {
+		nested_count++;
+	}
+	void increment() {
+		count++;
+	}
+};
+
+TEST_CASE("[CommandQueue] Flushing from within a command") {
+	CommandQueueMT command_queue(false);
+	NestedFlusher flusher;
+	flusher.command_queue = &command_queue;
+
+	command_queue.push(&flusher, &NestedFlusher::push_many_and_flush);
+	command_queue.push(&flusher, &NestedFlusher::increment);
+	command_queue.flush_all();
+
+	CHECK_MESSAGE(flusher.nested_count == 10000,
+			"Commands pushed before the nested flush should have run in it.");
+	CHECK_MESSAGE(flusher.count == 2,
+			"Commands following the flushing command should still run.");
+}
+
+class ThroughputCounter {
+public:
+	uint64_t count = 0;
+
+	void increment(uint64_t p_value) {
+		count += p_value;
+	}
+};
+
+struct ThroughputData {
+	CommandQueueMT *command_queue = nullptr;
+	ThroughputCounter *counter = nullptr;
+	int commands = 0;
+	SafeFlag done;
+};
+
+static void throughput_writer(void *p_userdata) {
+	ThroughputData *data = (ThroughputData *)p_userdata;
+	for (int i = 0; i < data->commands; i++) {
+		data->command_queue->push(data->counter, &ThroughputCounter::increment, (uint64_t)1);
+	}
+	data->done.set();
+}
+
+TEST_CASE("[CommandQueue][Benchmark] Push and flush from separate threads" * doctest::skip()) {
+	CommandQueueMT command_queue(false);
+	ThroughputCounter counter;
+
+	ThroughputData data;
+	data.command_queue = &command_queue;
+	data.counter = &counter;
+	data.commands = 10000000;
+
+	const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	Thread writer;
+	writer.start(throughput_writer, &data);
+	while (!data.done.is_set()) {
+		command_queue.flush_if_pending();
+	}
+	writer.wait_to_finish();
+	command_queue.flush_all();
+	const uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE("Pushing while flushing on another thread: ", elapsed * 1000.0 / data.commands, " ns per command.");
+	CHECK(counter.count == (uint64_t)data.commands);
+}
 } // namespace TestCommandQueue
 
 #endif // TEST_COMMAND_QUEUE_H
@@ -0,0 +1,195 @@
+/**************************************************************************/
+/*  test_resource_importer_scene.h                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_RESOURCE_IMPORTER_SCENE_H
+#define TEST_RESOURCE_IMPORTER_SCENE_H
+
+#include "core/os/os.h"
+#include "editor/import/resource_importer_scene.h"
+#include "scene/3d/mesh_instance_3d.h"
+#include "scene/resources/primitive_meshes.h"
+#include "scene/resources/surface_tool.h"
+
+#include "tests/test_macros.h"
+
+class TestResourceImporterSceneAccessor {
+public:
+	static void generate_hlod_proxies(Node *p_scene, float p_cell_size, float p_detail_ratio) {
+		ResourceImporterScene::_generate_hlod_proxies(p_scene, p_cell_size, 150.0, 0.0, p_detail_ratio, false);
+	}
+};
+
+namespace TestResourceImporterScene {
+
+static Ref<ArrayMesh> make_sphere_mesh(bool p_indexed) {
+	Array arrays;
+	SphereMesh::create_mesh_array(arrays, 0.5, 1.0, 32, 16);
+	if (!p_indexed) {
+		Ref<SurfaceTool> st;
+		st.instantiate();
+		st->create_from_triangle_arrays(arrays);
+		st->deindex();
+		arrays = st->commit_to_arrays();
+	}
+
+	Ref<ArrayMesh> mesh;
+	mesh.instantiate();
+	mesh->add_surface_from_arrays(Mesh::PRIMITIVE_TRIANGLES, arrays);
+	return mesh;
+}
+
+static int get_triangle_count(const Ref<Mesh> &p_mesh) {
+	int triangles = 0;
+	for (int i = 0; i < p_mesh->get_surface_count(); i++) {
+		int index_count = p_mesh->surface_get_array_index_len(i);
+		triangles += (index_count > 0 ? index_count : p_mesh->surface_get_array_len(i)) / 3;
+	}
+	return triangles;
+}
+
+static MeshInstance3D *add_mesh_instance(Node3D *p_scene, const Ref<Mesh> &p_mesh, const Vector3 &p_position) {
+	MeshInstance3D *mesh_instance = memnew(MeshInstance3D);
+	mesh_instance->set_mesh(p_mesh);
+	mesh_instance->set_position(p_position);
+	p_scene->add_child(mesh_instance, true);
+	mesh_instance->set_owner(p_scene);
+	return mesh_instance;
+}
+
+static MeshInstance3D *find_hlod_proxy(Node *p_scene) {
+	for (int i = 0; i < p_scene->get_child_count(); i++) {
+		if (String(p_scene->get_child(i)->get_name()).begins_with("HLOD_")) {
+			return Object::cast_to<MeshInstance3D>(p_scene->get_child(i));
+		}
+	}
+	return nullptr;
+}
+
+TEST_CASE("[SceneTree][ResourceImporterScene] HLOD proxies keep the triangles of indexed and non-indexed sources") {
+	Ref<ArrayMesh> indexed = make_sphere_mesh(true);
+	Ref<ArrayMesh> non_indexed = make_sphere_mesh(false);
+	REQUIRE(indexed->surface_get_array_index_len(0) > 0);
+	REQUIRE(non_indexed->surface_get_array_index_len(0) == 0);
+
+	Node3D *scene = memnew(Node3D);
+	LocalVector<MeshInstance3D *> sources;
+
+	SUBCASE("Indexed source first") {
+		sources.push_back(add_mesh_instance(scene, indexed, Vector3(1, 1, 1)));
+		sources.push_back(add_mesh_instance(scene, non_indexed, Vector3(3, 1, 1)));
+		sources.push_back(add_mesh_instance(scene, indexed, Vector3(1, 3, 1)));
+	}
+
+	SUBCASE("Non-indexed source first") {
+		sources.push_back(add_mesh_instance(scene, non_indexed, Vector3(1, 1, 1)));
+		sources.push_back(add_mesh_instance(scene, indexed, Vector3(3, 1, 1)));
+		sources.push_back(add_mesh_instance(scene, non_indexed, Vector3(1, 3, 1)));
+	}
+
+	int source_triangles = 0;
+	for (MeshInstance3D *source : sources) {
+		source_triangles += get_triangle_count(source->get_mesh());
+	}
+
+	TestResourceImporterSceneAccessor::generate_hlod_proxies(scene, 64.0, 1.0);
+
+	MeshInstance3D *proxy = find_hlod_proxy(scene);
+	REQUIRE(proxy != nullptr);
+	REQUIRE(proxy->get_mesh().is_valid());
+	CHECK_MESSAGE(proxy->get_mesh()->get_surface_count() == 1, "Sources sharing a material should be merged into a single surface.");
+	CHECK_MESSAGE(get_triangle_count(proxy->get_mesh()) == source_triangles, "No triangles should be dropped when merging.");
+
+	for (MeshInstance3D *source : sources) {
+		CHECK(source->get_node_or_null(source->get_visibility_parent()) == proxy);
+	}
+
+	memdelete(scene);
+}
+
+TEST_CASE("[SceneTree][ResourceImporterScene] HLOD proxies are simplified") {
+	if (!SurfaceTool::simplify_func) {
+		MESSAGE("Skipping, mesh simplification is not available in this build.");
+		return;
+	}
+
+	Ref<ArrayMesh> sphere = make_sphere_mesh(true);
+	Node3D *scene = memnew(Node3D);
+	for (int i = 0; i < 4; i++) {
+		add_mesh_instance(scene, sphere, Vector3(1 + i * 2, 1, 1));
+	}
+	const int source_triangles = get_triangle_count(sphere) * 4;
+
+	TestResourceImporterSceneAccessor::generate_hlod_proxies(scene, 64.0, 0.25);
+
+	MeshInstance3D *proxy = find_hlod_proxy(scene);
+	REQUIRE(proxy != nullptr);
+	const int proxy_triangles = get_triangle_count(proxy->get_mesh());
+	CHECK(proxy_triangles > 0);
+	CHECK(proxy_triangles <= source_triangles / 4);
+	CHECK_MESSAGE(proxy->get_mesh()->surface_get_array_len(0) < sphere->surface_get_array_len(0) * 4, "Vertices no longer referenced by the simplified proxy should be removed.");
+
+	memdelete(scene);
+}
+
+TEST_CASE("[SceneTree][ResourceImporterScene][Benchmark] HLOD proxy generation" * doctest::skip()) {
+	const int grid_size = 32;
+	const float spacing = 4.0;
+	const float cell_size = 32.0;
+
+	Ref<ArrayMesh> sphere = make_sphere_mesh(true);
+	Node3D *scene = memnew(Node3D);
+	for (int x = 0; x < grid_size; x++) {
+		for (int z = 0; z < grid_size; z++) {
+			add_mesh_instance(scene, sphere, Vector3(x * spacing, 0, z * spacing));
+		}
+	}
+	const int source_count = scene->get_child_count();
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	TestResourceImporterSceneAccessor::generate_hlod_proxies(scene, cell_size, 0.25);
+	uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+	int proxy_count = 0;
+	int proxy_triangles = 0;
+	for (int i = source_count; i < scene->get_child_count(); i++) {
+		MeshInstance3D *proxy = Object::cast_to<MeshInstance3D>(scene->get_child(i));
+		proxy_count++;
+		proxy_triangles += get_triangle_count(proxy->get_mesh());
+	}
+
+	MESSAGE(vformat("%d instances (%d triangles) merged into %d proxies (%d triangles) in %.2f msec.", source_count, source_count * get_triangle_count(sphere), proxy_count, proxy_triangles, elapsed / 1000.0));
+	MESSAGE(vformat("Instances drawn beyond the HLOD distance: %d before, %d after.", source_count, proxy_count));
+
+	memdelete(scene);
+}
+
+} // namespace TestResourceImporterScene
+
+#endif // TEST_RESOURCE_IMPORTER_SCENE_H
@@ -0,0 +1,182 @@
+/**************************************************************************/
+/*  test_container.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_CONTAINER_H
+#define TEST_CONTAINER_H
+
+#include "core/object/message_queue.h"
+#include "core/os/os.h"
+#include "scene/gui/box_container.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestContainer {
+
+class SortCountingBox : public BoxContainer {
+	GDCLASS(SortCountingBox, BoxContainer);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_SORT_CHILDREN) {
+			sort_count++;
+		}
+	}
+
+public:
+	int sort_count = 0;
+
+	SortCountingBox(bool p_vertical = true) :
+			BoxContainer(p_vertical) {}
+};
+
+// Builds a tree of alternating vertical and horizontal boxes with p_branching children per level,
+// and p_branching leaves of 10x10 below the deepest level.
+static void _build_layout(SortCountingBox *p_parent, int p_depth, int p_branching, LocalVector<SortCountingBox *> &r_boxes, LocalVector<Control *> &r_leaves) {
+	for (int i = 0; i < p_branching; i++) {
+		if (p_depth == 0) {
+			Control *leaf = memnew(Control);
+			leaf->set_custom_minimum_size(Size2(10, 10));
+			p_parent->add_child(leaf);
+			r_leaves.push_back(leaf);
+		} else {
+			SortCountingBox *box = memnew(SortCountingBox(!p_parent->is_vertical()));
+			p_parent->add_child(box);
+			r_boxes.push_back(box);
+			_build_layout(box, p_depth - 1, p_branching, r_boxes, r_leaves);
+		}
+	}
+}
+
+static int _reset_sort_counts(const LocalVector<SortCountingBox *> &p_boxes) {
+	int total = 0;
+	for (SortCountingBox *box : p_boxes) {
+		total += box->sort_count;
+		box->sort_count = 0;
+	}
+	return total;
+}
+
+TEST_CASE("[SceneTree][Container] Layout changes sort each affected container once") {
+	SortCountingBox *root_box = memnew(SortCountingBox);
+	SceneTree::get_singleton()->get_root()->add_child(root_box);
+
+	LocalVector<SortCountingBox *> boxes;
+	LocalVector<Control *> leaves;
+	boxes.push_back(root_box);
+	_build_layout(root_box, 2, 4, boxes, leaves);
+	MessageQueue::get_singleton()->flush();
+	_reset_sort_counts(boxes);
+
+	// root_box (vertical) > boxes[1] (horizontal) > boxes[2..5] (vertical) > leaves[0..15].
+	const real_t separation = boxes[2]->get_theme_constant(SNAME("separation"));
+
+	SUBCASE("A minimum size change sorts every affected container once") {
+		leaves[0]->set_custom_minimum_size(Size2(10, 30));
+		MessageQueue::get_singleton()->flush();
+
+		// boxes[2] grows, which makes boxes[1] and its other children taller as well.
+		for (int i = 0; i < 6; i++) {
+			CHECK_EQ(boxes[i]->sort_count, 1);
+		}
+		CHECK_EQ(_reset_sort_counts(boxes), 6);
+
+		CHECK_EQ(leaves[0]->get_size(), Size2(10, 30));
+		CHECK_EQ(leaves[1]->get_position(), Point2(0, 30 + separation));
+		CHECK_EQ(boxes[1]->get_size().y, 60 + 3 * separation);
+	}
+
+	SUBCASE("Several changes below the same containers are sorted together") {
+		for (int i = 0; i < 16; i++) {
+			leaves[i]->set_custom_minimum_size(Size2(20, 20));
+		}
+		MessageQueue::get_singleton()->flush();
+
+		for (int i = 0; i < 6; i++) {
+			CHECK_EQ(boxes[i]->sort_count, 1);
+		}
+		for (SortCountingBox *box : boxes) {
+			CHECK(box->sort_count <= 1);
+		}
+		CHECK_EQ(leaves[15]->get_rect(), Rect2(0, 3 * (20 + separation), 20, 20));
+	}
+
+	SUBCASE("Hidden containers are sorted once they are shown") {
+		boxes[1]->hide();
+		MessageQueue::get_singleton()->flush();
+		_reset_sort_counts(boxes);
+
+		leaves[0]->set_custom_minimum_size(Size2(10, 30));
+		MessageQueue::get_singleton()->flush();
+		CHECK_EQ(_reset_sort_counts(boxes), 0);
+
+		boxes[1]->show();
+		MessageQueue::get_singleton()->flush();
+		CHECK_EQ(boxes[2]->sort_count, 1);
+		CHECK_EQ(leaves[0]->get_size(), Size2(10, 30));
+	}
+
+	memdelete(root_box);
+}
+
+TEST_CASE("[SceneTree][Container][Benchmark] Nested layout updates" * doctest::skip()) {
+	const int depth = 5;
+	const int branching = 4;
+	const int frame_count = 100;
+	const int changes_per_frame = 8;
+
+	SortCountingBox *root_box = memnew(SortCountingBox);
+	SceneTree::get_singleton()->get_root()->add_child(root_box);
+
+	LocalVector<SortCountingBox *> boxes;
+	LocalVector<Control *> leaves;
+	boxes.push_back(root_box);
+	_build_layout(root_box, depth, branching, boxes, leaves);
+	MessageQueue::get_singleton()->flush();
+	_reset_sort_counts(boxes);
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < frame_count; i++) {
+		for (int j = 0; j < changes_per_frame; j++) {
+			Control *leaf = leaves[(i * changes_per_frame + j) * 7919 % leaves.size()];
+			leaf->set_custom_minimum_size(Size2(10, 10 + (i % 2) * 10));
+		}
+		MessageQueue::get_singleton()->flush();
+	}
+	uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("%d containers, %d leaves, %d frames of %d changes: %d sorts, %.1f us per frame.", boxes.size(), leaves.size(), frame_count, changes_per_frame, _reset_sort_counts(boxes), double(elapsed) / frame_count));
+
+	memdelete(root_box);
+}
+
+} // namespace TestContainer
+
+#endif // TEST_CONTAINER_H
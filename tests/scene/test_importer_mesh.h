@@ -0,0 +1,122 @@
+/**************************************************************************/
+/*  test_importer_mesh.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_IMPORTER_MESH_H
+#define TEST_IMPORTER_MESH_H
+
+#include "core/os/os.h"
+#include "scene/resources/importer_mesh.h"
+#include "scene/resources/primitive_meshes.h"
+#include "scene/resources/surface_tool.h"
+
+#include "tests/test_macros.h"
+
+namespace TestImporterMesh {
+
+static Vector<Array> make_lod_test_surfaces(int p_detail) {
+	Vector<Array> surfaces;
+
+	Array sphere;
+	SphereMesh::create_mesh_array(sphere, 1.0, 2.0, 16 * p_detail, 8 * p_detail);
+	surfaces.push_back(sphere);
+
+	Array capsule;
+	CapsuleMesh::create_mesh_array(capsule, 0.5, 2.0, 16 * p_detail, 4 * p_detail);
+	surfaces.push_back(capsule);
+
+	Array cylinder;
+	CylinderMesh::create_mesh_array(cylinder, 0.5, 1.0, 2.0, 16 * p_detail, 4 * p_detail);
+	surfaces.push_back(cylinder);
+
+	Array box;
+	BoxMesh::create_mesh_array(box, Vector3(1, 2, 3), 4 * p_detail, 4 * p_detail, 4 * p_detail);
+	surfaces.push_back(box);
+
+	return surfaces;
+}
+
+TEST_CASE("[ImporterMesh] LODs generated in parallel match LODs generated one surface at a time") {
+	if (!SurfaceTool::simplify_scale_func) {
+		MESSAGE("Skipping, mesh simplification is not available in this build.");
+		return;
+	}
+
+	const Vector<Array> surfaces = make_lod_test_surfaces(4);
+
+	Ref<ImporterMesh> combined;
+	combined.instantiate();
+	for (const Array &arrays : surfaces) {
+		combined->add_surface(Mesh::PRIMITIVE_TRIANGLES, arrays);
+	}
+	combined->generate_lods(25.0, 60.0, Array());
+
+	for (int i = 0; i < surfaces.size(); i++) {
+		Ref<ImporterMesh> single;
+		single.instantiate();
+		single->add_surface(Mesh::PRIMITIVE_TRIANGLES, surfaces[i]);
+		single->generate_lods(25.0, 60.0, Array());
+
+		CHECK_MESSAGE(combined->get_surface_lod_count(i) > 0, vformat("Surface %d should have LODs.", i));
+		REQUIRE(combined->get_surface_lod_count(i) == single->get_surface_lod_count(0));
+		for (int lod = 0; lod < single->get_surface_lod_count(0); lod++) {
+			CHECK(combined->get_surface_lod_size(i, lod) == single->get_surface_lod_size(0, lod));
+			CHECK(combined->get_surface_lod_indices(i, lod) == single->get_surface_lod_indices(0, lod));
+		}
+	}
+}
+
+TEST_CASE("[ImporterMesh][Benchmark] LOD generation" * doctest::skip()) {
+	if (!SurfaceTool::simplify_scale_func) {
+		return;
+	}
+
+	const Vector<Array> surfaces = make_lod_test_surfaces(16);
+	const int iterations = 5;
+
+	Ref<ImporterMesh> mesh;
+	mesh.instantiate();
+	for (int copy = 0; copy < 4; copy++) {
+		for (const Array &arrays : surfaces) {
+			mesh->add_surface(Mesh::PRIMITIVE_TRIANGLES, arrays);
+		}
+	}
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < iterations; i++) {
+		mesh->generate_lods(25.0, 60.0, Array());
+	}
+	uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("%d surfaces: %.2f msec per generate_lods() call.", mesh->get_surface_count(), elapsed / 1000.0 / iterations));
+}
+
+} // namespace TestImporterMesh
+
+#endif // TEST_IMPORTER_MESH_H
@@ -762,6 +762,254 @@ TEST_CASE("[SceneTree][Node] Test the process priority") {
 	memdelete(node4);
 }
 
+TEST_CASE("[SceneTree][Node] Readable names of many children") {
+	Node *parent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	LocalVector<Node *> children;
+	for (int i = 0; i < 10; i++) {
+		Node *child = memnew(Node);
+		child->set_name("Item");
+		parent->add_child(child, true);
+		children.push_back(child);
+	}
+	CHECK_EQ(children[0]->get_name(), StringName("Item"));
+	CHECK_EQ(children[1]->get_name(), StringName("Item2"));
+	CHECK_EQ(children[9]->get_name(), StringName("Item10"));
+
+	SUBCASE("Freed numbers are reused first") {
+		parent->remove_child(children[3]); // Item4
+		parent->remove_child(children[6]); // Item7
+
+		Node *child = memnew(Node);
+		child->set_name("Item");
+		parent->add_child(child, true);
+		CHECK_EQ(child->get_name(), StringName("Item4"));
+
+		child->set_name("Item");
+		CHECK_EQ(child->get_name(), StringName("Item4"));
+
+		child = memnew(Node);
+		child->set_name("Item");
+		parent->add_child(child, true);
+		CHECK_EQ(child->get_name(), StringName("Item7"));
+
+		child = memnew(Node);
+		child->set_name("Item");
+		parent->add_child(child, true);
+		CHECK_EQ(child->get_name(), StringName("Item11"));
+
+		memdelete(children[3]);
+		memdelete(children[6]);
+	}
+
+	SUBCASE("Renaming to a taken name keeps the current number when it's the next free one") {
+		children[2]->set_name("Item3");
+		CHECK_EQ(children[2]->get_name(), StringName("Item3"));
+
+		// Item3 and Item4 are taken by siblings, Item5 is its own name.
+		children[4]->set_name("Item3");
+		CHECK_EQ(children[4]->get_name(), StringName("Item5"));
+		children[4]->set_name("Item");
+		CHECK_EQ(children[4]->get_name(), StringName("Item5"));
+	}
+
+	SUBCASE("Renamed children free their numbers") {
+		children[1]->set_name("Other");
+
+		Node *child = memnew(Node);
+		child->set_name("Item5");
+		parent->add_child(child, true);
+		CHECK_EQ(child->get_name(), StringName("Item11"));
+
+		child = memnew(Node);
+		child->set_name("Item");
+		parent->add_child(child, true);
+		CHECK_EQ(child->get_name(), StringName("Item2"));
+	}
+
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Node] Adding and removing children in bulk") {
+	Node *parent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	TypedArray<Node> children;
+	for (int i = 0; i < 5; i++) {
+		Node *child = memnew(Node);
+		child->add_to_group("bulk_test");
+		child->set_process(true);
+		children.push_back(child);
+	}
+
+	Array empty_signal_args;
+	empty_signal_args.push_back(Array());
+	SIGNAL_WATCH(parent, "child_order_changed");
+
+	parent->add_children(children);
+	SIGNAL_CHECK("child_order_changed", empty_signal_args);
+	CHECK_EQ(parent->get_child_count(), 5);
+	for (int i = 0; i < 5; i++) {
+		CHECK_EQ(parent->get_child(i), Object::cast_to<Node>(children[i]));
+		CHECK(Object::cast_to<Node>(children[i])->is_inside_tree());
+	}
+	CHECK_EQ(SceneTree::get_singleton()->get_node_count_in_group("bulk_test"), 5);
+
+	Node *kept = Object::cast_to<Node>(children[2]);
+	TypedArray<Node> removed;
+	removed.push_back(children[0]);
+	removed.push_back(children[4]);
+	removed.push_back(children[1]);
+
+	SUBCASE("Remove") {
+		parent->remove_children(removed);
+		SIGNAL_CHECK("child_order_changed", empty_signal_args);
+		CHECK_EQ(parent->get_child_count(), 2);
+		CHECK_EQ(parent->get_child(0), kept);
+		CHECK_EQ(SceneTree::get_singleton()->get_node_count_in_group("bulk_test"), 2);
+		CHECK_EQ(SceneTree::get_singleton()->get_first_node_in_group("bulk_test"), kept);
+		for (int i = 0; i < removed.size(); i++) {
+			Node *node = Object::cast_to<Node>(removed[i]);
+			CHECK_FALSE(node->is_inside_tree());
+			CHECK(node->get_parent() == nullptr);
+			memdelete(node);
+		}
+	}
+
+	SUBCASE("Free") {
+		ObjectID freed_id = Object::cast_to<Node>(removed[0])->get_instance_id();
+		parent->free_children(removed);
+		SIGNAL_CHECK("child_order_changed", empty_signal_args);
+		CHECK_EQ(parent->get_child_count(), 2);
+		CHECK(ObjectDB::get_instance(freed_id) == nullptr);
+		CHECK_EQ(SceneTree::get_singleton()->get_node_count_in_group("bulk_test"), 2);
+	}
+
+	SUBCASE("Free keeps children added to another parent while removing") {
+		Node *reparented = Object::cast_to<Node>(removed[0]);
+		parent->connect("child_order_changed", callable_mp((Node *)kept, &Node::add_child).bind(reparented, false, Node::INTERNAL_MODE_DISABLED), Object::CONNECT_ONE_SHOT);
+		ObjectID freed_id = Object::cast_to<Node>(removed[1])->get_instance_id();
+		parent->free_children(removed);
+		SIGNAL_CHECK("child_order_changed", empty_signal_args);
+		CHECK(ObjectDB::get_instance(freed_id) == nullptr);
+		CHECK_EQ(reparented->get_parent(), kept);
+		CHECK(reparented->is_inside_tree());
+	}
+
+	// Only the remaining children are processed.
+	SceneTree::get_singleton()->process(0);
+
+	SIGNAL_UNWATCH(parent, "child_order_changed");
+	memdelete(parent);
+}
+
+TEST_CASE("[SceneTree][Node] Group membership and queries") {
+	Node *parent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	LocalVector<Node *> nodes;
+	for (int i = 0; i < 6; i++) {
+		Node *node = memnew(Node);
+		parent->add_child(node);
+		node->add_to_group("even_or_odd");
+		node->add_to_group(i % 2 ? "odd" : "even");
+		if (i % 3 == 0) {
+			node->add_to_group("third");
+		}
+		nodes.push_back(node);
+	}
+
+	// Removing from the middle replaces the node by the last one, the tree order is restored when queried.
+	nodes[1]->remove_from_group("even_or_odd");
+	nodes[2]->remove_from_group("even_or_odd");
+	CHECK_EQ(SceneTree::get_singleton()->get_node_count_in_group("even_or_odd"), 4);
+	List<Node *> ordered;
+	SceneTree::get_singleton()->get_nodes_in_group("even_or_odd", &ordered);
+	REQUIRE_EQ(ordered.size(), 4);
+	CHECK_EQ(ordered[0], nodes[0]);
+	CHECK_EQ(ordered[1], nodes[3]);
+	CHECK_EQ(ordered[2], nodes[4]);
+	CHECK_EQ(ordered[3], nodes[5]);
+
+	Vector<StringName> groups;
+	groups.push_back("even");
+	groups.push_back("third");
+	LocalVector<Node *> result;
+
+	SceneTree::get_singleton()->get_nodes_in_groups(groups, SceneTree::GROUP_QUERY_ALL, result);
+	REQUIRE_EQ(result.size(), 1u);
+	CHECK_EQ(result[0], nodes[0]);
+
+	SceneTree::get_singleton()->get_nodes_in_groups(groups, SceneTree::GROUP_QUERY_ANY, result, true);
+	REQUIRE_EQ(result.size(), 4u);
+	CHECK_EQ(result[0], nodes[0]);
+	CHECK_EQ(result[1], nodes[2]);
+	CHECK_EQ(result[2], nodes[3]);
+	CHECK_EQ(result[3], nodes[4]);
+
+	groups.push_back("missing");
+	SceneTree::get_singleton()->get_nodes_in_groups(groups, SceneTree::GROUP_QUERY_ALL, result);
+	CHECK(result.is_empty());
+
+	parent->remove_child(nodes[0]);
+	CHECK_EQ(SceneTree::get_singleton()->get_node_count_in_group("third"), 1);
+	CHECK_EQ(SceneTree::get_singleton()->get_first_node_in_group("third"), nodes[3]);
+	parent->add_child(nodes[0]);
+	CHECK_EQ(SceneTree::get_singleton()->get_first_node_in_group("third"), nodes[3]);
+	parent->move_child(nodes[0], 0);
+	CHECK_EQ(SceneTree::get_singleton()->get_first_node_in_group("third"), nodes[0]);
+
+	memdelete(parent);
+	CHECK_FALSE(SceneTree::get_singleton()->has_group("even_or_odd"));
+}
+
+// Run with `--no-skip` to compare adding and freeing many children one by one against the bulk methods.
+TEST_CASE("[SceneTree][Node][Benchmark] Bulk child addition and removal" * doctest::skip()) {
+	const int node_count = 5000;
+
+	Node *parent = memnew(Node);
+	SceneTree::get_singleton()->get_root()->add_child(parent);
+
+	for (int pass = 0; pass < 2; pass++) {
+		const bool bulk = pass == 1;
+
+		TypedArray<Node> nodes;
+		for (int i = 0; i < node_count; i++) {
+			Node *node = memnew(Node);
+			node->set_name("Bullet");
+			node->add_to_group("bullets");
+			node->set_process(true);
+			nodes.push_back(node);
+		}
+
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		if (bulk) {
+			parent->add_children(nodes, true);
+		} else {
+			for (int i = 0; i < node_count; i++) {
+				parent->add_child(Object::cast_to<Node>(nodes[i]), true);
+			}
+		}
+		const uint64_t add_time = OS::get_singleton()->get_ticks_usec() - begin;
+
+		begin = OS::get_singleton()->get_ticks_usec();
+		if (bulk) {
+			parent->free_children(nodes);
+		} else {
+			for (int i = 0; i < node_count; i++) {
+				memdelete(Object::cast_to<Node>(nodes[i]));
+			}
+		}
+		const uint64_t free_time = OS::get_singleton()->get_ticks_usec() - begin;
+
+		MESSAGE(vformat("%s, %d nodes: adding %.2f ms, freeing %.2f ms.", bulk ? "Bulk" : "One by one", node_count, add_time / 1000.0, free_time / 1000.0));
+		CHECK_EQ(parent->get_child_count(), 0);
+	}
+
+	memdelete(parent);
+}
+
 } // namespace TestNode
 
 #endif // TEST_NODE_H
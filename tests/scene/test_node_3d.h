@@ -0,0 +1,194 @@
+/**************************************************************************/
+/*  test_node_3d.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_NODE_3D_H
+#define TEST_NODE_3D_H
+
+#include "core/math/random_pcg.h"
+#include "scene/3d/node_3d.h"
+#include "scene/3d/visual_instance_3d.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+class TestNode3DAccessor {
+public:
+	static void set_parallel_transform_resolve(bool p_enabled) {
+		SceneTree::get_singleton()->parallel_transform_resolve = p_enabled;
+	}
+
+	static bool is_parallel_transform_resolve_enabled() {
+		return SceneTree::get_singleton()->parallel_transform_resolve;
+	}
+
+	static bool is_global_transform_dirty(const Node3D *p_node) {
+		return p_node->_test_dirty_bits(Node3D::DIRTY_GLOBAL_TRANSFORM);
+	}
+};
+
+namespace TestNode3D {
+
+static Transform3D random_transform(RandomPCG &p_rng) {
+	Basis basis = Basis::from_euler(Vector3(p_rng.randf(), p_rng.randf(), p_rng.randf()) * Math_TAU);
+	basis.scale(Vector3(0.5, 0.5, 0.5) + Vector3(p_rng.randf(), p_rng.randf(), p_rng.randf()));
+	return Transform3D(basis, Vector3(p_rng.randf() - 0.5, p_rng.randf() - 0.5, p_rng.randf() - 0.5) * 20.0);
+}
+
+// Builds a wide hierarchy, so that the dirty nodes are enough to be resolved in parallel.
+// Only the leaves ask for transform notifications, the ancestors they depend on have to be gathered.
+static Node3D *build_tree(uint32_t p_seed, LocalVector<Node3D *> &r_nodes, LocalVector<Node3D *> &r_leaves) {
+	RandomPCG rng(p_seed);
+	Node3D *root = memnew(Node3D);
+	r_nodes.push_back(root);
+	for (int i = 0; i < 8; i++) {
+		Node3D *branch = memnew(Node3D);
+		branch->set_transform(random_transform(rng));
+		root->add_child(branch);
+		r_nodes.push_back(branch);
+		for (int j = 0; j < 40; j++) {
+			Node3D *twig = memnew(Node3D);
+			twig->set_transform(random_transform(rng));
+			twig->set_as_top_level(j % 13 == 0);
+			branch->add_child(twig);
+			r_nodes.push_back(twig);
+			for (int k = 0; k < 4; k++) {
+				Node3D *leaf = memnew(Node3D);
+				leaf->set_transform(random_transform(rng));
+				leaf->set_disable_scale(k == 3);
+				leaf->set_notify_transform(true);
+				twig->add_child(leaf);
+				r_nodes.push_back(leaf);
+				r_leaves.push_back(leaf);
+			}
+		}
+	}
+	return root;
+}
+
+// Moves a deterministic selection of nodes at every level, then flushes the transform notifications.
+static void move_nodes(uint32_t p_seed, const LocalVector<Node3D *> &p_nodes) {
+	RandomPCG rng(p_seed);
+	for (uint32_t i = 0; i < p_nodes.size(); i++) {
+		if (i == 0 || rng.randf() < 0.3) {
+			p_nodes[i]->set_transform(random_transform(rng));
+		}
+	}
+	SceneTree::get_singleton()->flush_transform_notifications();
+}
+
+TEST_CASE("[SceneTree][Node3D] Parallel transform resolve matches serial transform resolve") {
+	const bool was_enabled = TestNode3DAccessor::is_parallel_transform_resolve_enabled();
+
+	LocalVector<Node3D *> serial_nodes;
+	LocalVector<Node3D *> serial_leaves;
+	Node3D *serial_root = build_tree(1234, serial_nodes, serial_leaves);
+	LocalVector<Node3D *> parallel_nodes;
+	LocalVector<Node3D *> parallel_leaves;
+	Node3D *parallel_root = build_tree(1234, parallel_nodes, parallel_leaves);
+
+	SceneTree::get_singleton()->get_root()->add_child(serial_root);
+	SceneTree::get_singleton()->get_root()->add_child(parallel_root);
+	SceneTree::get_singleton()->flush_transform_notifications();
+
+	for (int round = 0; round < 3; round++) {
+		TestNode3DAccessor::set_parallel_transform_resolve(false);
+		move_nodes(round, serial_nodes);
+
+		TestNode3DAccessor::set_parallel_transform_resolve(true);
+		move_nodes(round, parallel_nodes);
+
+		bool resolved = true;
+		for (const Node3D *leaf : parallel_leaves) {
+			if (TestNode3DAccessor::is_global_transform_dirty(leaf)) {
+				resolved = false;
+			}
+		}
+		CHECK_MESSAGE(resolved, "The global transforms of notified nodes should be resolved before the notifications are sent.");
+
+		bool matches = true;
+		for (uint32_t i = 0; i < serial_nodes.size(); i++) {
+			if (serial_nodes[i]->get_global_transform() != parallel_nodes[i]->get_global_transform()) {
+				matches = false;
+			}
+		}
+		CHECK_MESSAGE(matches, vformat("Round %d: global transforms should be identical whether they are resolved in parallel or not.", round));
+	}
+
+	TestNode3DAccessor::set_parallel_transform_resolve(was_enabled);
+	memdelete(serial_root);
+	memdelete(parallel_root);
+}
+
+TEST_CASE("[SceneTree][VisualInstance3D] Instance transforms reach the RenderingServer") {
+	RenderingServer *rs = RS::get_singleton();
+	RID mesh = rs->mesh_create();
+
+	VisualInstance3D *node = memnew(VisualInstance3D);
+	node->set_base(mesh);
+	rs->instance_set_custom_aabb(node->get_instance(), AABB(Vector3(-0.5, -0.5, -0.5), Vector3(1, 1, 1)));
+	SceneTree::get_singleton()->get_root()->add_child(node);
+	SceneTree::get_singleton()->flush_transform_notifications();
+
+	const RID scenario = node->get_world_3d()->get_scenario();
+	const AABB target = AABB(Vector3(9.9, -0.1, -0.1), Vector3(0.2, 0.2, 0.2));
+	const bool was_batching = VisualInstance3D::is_batching_transform_updates();
+
+	SUBCASE("Immediately by default") {
+		VisualInstance3D::set_batch_transform_updates(false);
+		node->set_position(Vector3(10, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK_MESSAGE(rs->instances_cull_aabb(target, scenario).has(node->get_instance_id()), "Cull queries should see the new transform without waiting for the end of the frame.");
+	}
+
+	SUBCASE("In a single batch when enabled") {
+		VisualInstance3D::set_batch_transform_updates(true);
+		node->set_position(Vector3(10, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK_FALSE(rs->instances_cull_aabb(target, scenario).has(node->get_instance_id()));
+		VisualInstance3D::flush_transform_updates();
+		CHECK(rs->instances_cull_aabb(target, scenario).has(node->get_instance_id()));
+	}
+
+	SUBCASE("Queued transforms are sent when batching is disabled") {
+		VisualInstance3D::set_batch_transform_updates(true);
+		node->set_position(Vector3(10, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		VisualInstance3D::set_batch_transform_updates(false);
+		CHECK(rs->instances_cull_aabb(target, scenario).has(node->get_instance_id()));
+	}
+
+	VisualInstance3D::set_batch_transform_updates(was_batching);
+	memdelete(node);
+	rs->free(mesh);
+}
+
+} // namespace TestNode3D
+
+#endif // TEST_NODE_3D_H
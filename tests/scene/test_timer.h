@@ -0,0 +1,273 @@
+/**************************************************************************/
+/*  test_timer.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_TIMER_H
+#define TEST_TIMER_H
+
+#include "scene/main/timer.h"
+#include "scene/main/timer_wheel.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTimer {
+
+TEST_CASE("[TimerWheel] Expiry") {
+	TimerWheel wheel;
+	TimerWheel::Item items[3];
+	items[0].order = 0;
+	items[1].order = 1;
+	items[2].order = 2;
+	items[2].exclusive = true;
+
+	wheel.insert(&items[0], 0.5);
+	wheel.insert(&items[1], 10.0); // Spans more than one rotation of level 0.
+	wheel.insert(&items[2], 0.25);
+	CHECK(wheel.get_item_count() == 3);
+
+	LocalVector<TimerWheel::Item *> expired;
+	wheel.advance(0.125, expired);
+	CHECK(expired.is_empty());
+	CHECK(items[0].get_time_left() == doctest::Approx(0.375));
+
+	wheel.advance(0.125, expired);
+	CHECK_MESSAGE(expired.is_empty(), "Exclusive items should only expire once their deadline is passed.");
+
+	wheel.advance(0.25, expired);
+	REQUIRE(expired.size() == 2);
+	expired.sort_custom<TimerWheel::ItemOrderComparator>();
+	CHECK(expired[0] == &items[0]);
+	CHECK(expired[1] == &items[2]);
+	CHECK(items[0].expired);
+	CHECK(items[0].wheel == nullptr);
+	CHECK(items[2].expired_time_left == doctest::Approx(-0.25));
+	CHECK(wheel.get_item_count() == 1);
+
+	expired.clear();
+	wheel.advance(9.0, expired);
+	CHECK(expired.is_empty());
+	wheel.advance(0.5, expired);
+	REQUIRE(expired.size() == 1);
+	CHECK(expired[0] == &items[1]);
+	CHECK(wheel.get_item_count() == 0);
+}
+
+TEST_CASE("[TimerWheel] Removal and long delays") {
+	TimerWheel wheel;
+	LocalVector<TimerWheel::Item *> expired;
+
+	{
+		TimerWheel::Item item;
+		wheel.insert(&item, 1.0);
+		CHECK(wheel.get_item_count() == 1);
+	}
+	CHECK_MESSAGE(wheel.get_item_count() == 0, "Destroyed items should leave the wheel.");
+
+	TimerWheel::Item item;
+	wheel.insert(&item, 1.0);
+	wheel.remove(&item);
+	wheel.advance(2.0, expired);
+	CHECK(expired.is_empty());
+	CHECK_FALSE(item.expired);
+
+	// Beyond the last level, kept in the overflow list until it gets close.
+	const double long_delay = 6.0 * 3600.0;
+	wheel.insert(&item, long_delay);
+	for (int i = 0; i < 6 * 60; i++) {
+		wheel.advance(59.0, expired);
+	}
+	CHECK(expired.is_empty());
+	wheel.advance(long_delay - 6 * 60 * 59.0, expired);
+	REQUIRE(expired.size() == 1);
+	CHECK(expired[0] == &item);
+}
+
+TEST_CASE("[SceneTree][Timer] Timeouts") {
+	Timer *timer = memnew(Timer);
+	SceneTree::get_singleton()->get_root()->add_child(timer);
+
+	Array empty_signal_args;
+	empty_signal_args.push_back(Array());
+	SIGNAL_WATCH(timer, "timeout");
+
+	SUBCASE("One shot") {
+		timer->set_one_shot(true);
+		timer->start(0.5);
+		SceneTree::get_singleton()->process(0.3);
+		SIGNAL_CHECK_FALSE("timeout");
+		CHECK(timer->get_time_left() == doctest::Approx(0.2));
+
+		SceneTree::get_singleton()->process(0.3);
+		SIGNAL_CHECK("timeout", empty_signal_args);
+		CHECK(timer->is_stopped());
+
+		SceneTree::get_singleton()->process(1.0);
+		SIGNAL_CHECK_FALSE("timeout");
+	}
+
+	SUBCASE("Repeating timers carry over the elapsed time") {
+		timer->start(0.5);
+		SceneTree::get_singleton()->process(0.7);
+		SIGNAL_CHECK("timeout", empty_signal_args);
+		CHECK(timer->get_time_left() == doctest::Approx(0.3));
+	}
+
+	SUBCASE("Paused timers keep their time left") {
+		timer->start(0.5);
+		SceneTree::get_singleton()->process(0.2);
+		timer->set_paused(true);
+		SceneTree::get_singleton()->process(1.0);
+		SIGNAL_CHECK_FALSE("timeout");
+		CHECK(timer->get_time_left() == doctest::Approx(0.3));
+
+		timer->set_paused(false);
+		SceneTree::get_singleton()->process(0.4);
+		SIGNAL_CHECK("timeout", empty_signal_args);
+	}
+
+	SUBCASE("Physics timers") {
+		timer->set_timer_process_callback(Timer::TIMER_PROCESS_PHYSICS);
+		timer->start(0.5);
+		SceneTree::get_singleton()->process(1.0);
+		SIGNAL_CHECK_FALSE("timeout");
+		SceneTree::get_singleton()->physics_process(1.0);
+		SIGNAL_CHECK("timeout", empty_signal_args);
+	}
+
+	SUBCASE("Leaving the tree stops counting") {
+		timer->start(0.5);
+		SceneTree::get_singleton()->get_root()->remove_child(timer);
+		SceneTree::get_singleton()->process(1.0);
+		SIGNAL_CHECK_FALSE("timeout");
+		SceneTree::get_singleton()->get_root()->add_child(timer);
+		CHECK(timer->get_time_left() == doctest::Approx(0.5));
+	}
+
+	SIGNAL_UNWATCH(timer, "timeout");
+	memdelete(timer);
+}
+
+TEST_CASE("[SceneTree][SceneTreeTimer] Timeouts") {
+	Ref<SceneTreeTimer> stt = SceneTree::get_singleton()->create_timer(0.5);
+	SIGNAL_WATCH(stt.ptr(), "timeout");
+
+	Array empty_signal_args;
+	empty_signal_args.push_back(Array());
+
+	SceneTree::get_singleton()->process(0.25);
+	SIGNAL_CHECK_FALSE("timeout");
+	CHECK(stt->get_time_left() == doctest::Approx(0.25));
+
+	stt->set_time_left(1.0);
+	SceneTree::get_singleton()->process(0.5);
+	SIGNAL_CHECK_FALSE("timeout");
+
+	SceneTree::get_singleton()->process(0.5);
+	SIGNAL_CHECK("timeout", empty_signal_args);
+	CHECK(stt->get_time_left() == 0);
+	CHECK_MESSAGE(stt->get_reference_count() == 1, "The tree should release the timer after its timeout.");
+
+	SIGNAL_UNWATCH(stt.ptr(), "timeout");
+}
+
+class TimerRestarter : public Node {
+	GDCLASS(TimerRestarter, Node);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_PROCESS && restarting) {
+			for (Timer *timer : timers) {
+				timer->stop();
+				timer->start(0.5);
+			}
+		}
+	}
+
+public:
+	LocalVector<Timer *> timers;
+	bool restarting = true;
+	int timeouts = 0;
+
+	void on_timeout() {
+		timeouts++;
+	}
+};
+
+TEST_CASE("[SceneTree][Timer] Restarting timers from threaded processing groups") {
+	const int group_count = 8;
+	const int timers_per_group = 64;
+
+	LocalVector<Node *> groups;
+	LocalVector<TimerRestarter *> restarters;
+	for (int i = 0; i < group_count; i++) {
+		Node *group = memnew(Node);
+		group->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+		SceneTree::get_singleton()->get_root()->add_child(group);
+		groups.push_back(group);
+
+		TimerRestarter *restarter = memnew(TimerRestarter);
+		group->add_child(restarter);
+		restarter->set_process(true);
+		restarters.push_back(restarter);
+
+		for (int j = 0; j < timers_per_group; j++) {
+			Timer *timer = memnew(Timer);
+			group->add_child(timer);
+			timer->connect("timeout", callable_mp(restarter, &TimerRestarter::on_timeout));
+			timer->set_one_shot(true);
+			timer->start(0.5);
+			restarter->timers.push_back(timer);
+		}
+	}
+
+	// Each frame, every group stops and starts its timers on its own thread.
+	for (int i = 0; i < 20; i++) {
+		SceneTree::get_singleton()->process(0.1);
+	}
+	for (TimerRestarter *restarter : restarters) {
+		CHECK_MESSAGE(restarter->timeouts == 0, "Timers restarted every frame should never time out.");
+		CHECK(restarter->timers[0]->get_time_left() == doctest::Approx(0.4));
+		restarter->restarting = false;
+	}
+
+	SceneTree::get_singleton()->process(0.3);
+	SceneTree::get_singleton()->process(0.3);
+	for (TimerRestarter *restarter : restarters) {
+		CHECK_MESSAGE(restarter->timeouts == timers_per_group, "Every timer should time out once.");
+	}
+
+	for (Node *group : groups) {
+		memdelete(group);
+	}
+}
+
+} // namespace TestTimer
+
+#endif // TEST_TIMER_H
@@ -0,0 +1,125 @@
+/**************************************************************************/
+/*  test_tween.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_TWEEN_H
+#define TEST_TWEEN_H
+
+#include "core/os/os.h"
+#include "scene/2d/node_2d.h"
+#include "scene/animation/tween.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTween {
+
+TEST_CASE("[SceneTree][Tween] Property tweens interpolate like Variants") {
+	Node2D *node = memnew(Node2D);
+	SceneTree::get_singleton()->get_root()->add_child(node);
+
+	Ref<Tween> tween = node->create_tween();
+	tween->set_parallel(true);
+	tween->set_trans(Tween::TRANS_SINE);
+	tween->tween_property(node, NodePath("position"), Vector2(100, 50), 1.0);
+	tween->tween_property(node, NodePath("rotation"), 2.0, 1.0);
+	tween->tween_property(node, NodePath("modulate"), Color(0.5, 0.25, 1, 0), 1.0);
+	tween->tween_property(node, NodePath("scale:x"), 3.0, 1.0);
+
+	SceneTree::get_singleton()->process(0.3);
+
+	CHECK_EQ(node->get_position(), Vector2(Tween::interpolate_variant(Vector2(), Vector2(100, 50), 0.3, 1.0, Tween::TRANS_SINE, Tween::EASE_IN_OUT)));
+	CHECK_EQ(node->get_rotation(), real_t(Tween::interpolate_variant(0.0, 2.0, 0.3, 1.0, Tween::TRANS_SINE, Tween::EASE_IN_OUT)));
+	CHECK_EQ(node->get_modulate(), Color(Tween::interpolate_variant(Color(1, 1, 1), Color(-0.5, -0.75, 0, -1), 0.3, 1.0, Tween::TRANS_SINE, Tween::EASE_IN_OUT)));
+	CHECK_EQ(node->get_scale().x, real_t(Tween::interpolate_variant(1.0, 2.0, 0.3, 1.0, Tween::TRANS_SINE, Tween::EASE_IN_OUT)));
+
+	SceneTree::get_singleton()->process(0.8);
+
+	CHECK_EQ(node->get_position(), Vector2(100, 50));
+	CHECK_EQ(node->get_rotation(), 2.0);
+	CHECK_EQ(node->get_modulate(), Color(0.5, 0.25, 1, 0));
+	CHECK_EQ(node->get_scale(), Vector2(3, 1));
+	CHECK_FALSE(tween->is_running());
+
+	memdelete(node);
+}
+
+TEST_CASE("[SceneTree][Tween] Relative and delayed property tweens") {
+	Node2D *node = memnew(Node2D);
+	SceneTree::get_singleton()->get_root()->add_child(node);
+	node->set_position(Vector2(10, 10));
+
+	Ref<Tween> tween = node->create_tween();
+	tween->tween_property(node, NodePath("position"), Vector2(20, 0), 1.0)->as_relative();
+	tween->tween_property(node, NodePath("position"), Vector2(0, 0), 1.0)->set_delay(0.5);
+
+	SceneTree::get_singleton()->process(0.5);
+	CHECK_EQ(node->get_position(), Vector2(20, 10));
+
+	SceneTree::get_singleton()->process(0.5);
+	CHECK_EQ(node->get_position(), Vector2(30, 10));
+
+	// Moved during the delay, the second tween continues from there.
+	SceneTree::get_singleton()->process(0.25);
+	node->set_position(Vector2(40, 40));
+	SceneTree::get_singleton()->process(0.75);
+	CHECK_EQ(node->get_position(), Vector2(20, 20));
+
+	memdelete(node);
+}
+
+TEST_CASE("[SceneTree][Tween][Benchmark] Property tweens per millisecond" * doctest::skip()) {
+	const int node_count = 10000;
+	const int frame_count = 60;
+
+	LocalVector<Node2D *> nodes;
+	for (int i = 0; i < node_count; i++) {
+		Node2D *node = memnew(Node2D);
+		SceneTree::get_singleton()->get_root()->add_child(node);
+		node->create_tween()->tween_property(node, NodePath("position"), Vector2(i, 100), 10.0);
+		nodes.push_back(node);
+	}
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < frame_count; i++) {
+		SceneTree::get_singleton()->process(1.0 / 60.0);
+	}
+	uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("%d tweens, %d frames: %.1f tween steps per ms.", node_count, frame_count, double(node_count) * frame_count * 1000.0 / double(MAX(elapsed, uint64_t(1)))));
+	CHECK(nodes[node_count - 1]->get_position() != Vector2());
+
+	for (Node2D *node : nodes) {
+		memdelete(node);
+	}
+}
+
+} // namespace TestTween
+
+#endif // TEST_TWEEN_H
@@ -41,6 +41,13 @@
 
 #include "tests/test_macros.h"
 
+class TestViewportAccessor {
+public:
+	static bool is_gui_pick_index_dirty(const Viewport *p_viewport) {
+		return p_viewport->gui.pick_index.dirty;
+	}
+};
+
 namespace TestViewport {
 
 class NotificationControlViewport : public Control {
@@ -223,7 +230,7 @@ TEST_CASE("[SceneTree][Viewport] Controls and InputEvent handling") {
 	Point2i on_background = Point2i(500, 500);
 	Point2i on_outside = Point2i(-1, -1);
 
-	// Unit tests for Viewport::gui_find_control and Viewport::_gui_find_control_at_pos
+	// Unit tests for Viewport::gui_find_control
 	SUBCASE("[VIEWPORT][GuiFindControl] Finding Controls at a Viewport-position") {
 		// FIXME: It is extremely difficult to create a situation where the Control has a zero determinant.
 		// Leaving that if-branch untested.
@@ -267,6 +274,111 @@ TEST_CASE("[SceneTree][Viewport] Controls and InputEvent handling") {
 			CHECK_FALSE(root->gui_find_control(on_d + Point2i(20, 20)));
 			CHECK(root->gui_find_control(on_b) == node_d);
 		}
+
+		SUBCASE("[VIEWPORT][GuiFindControl] Changes after a search are taken into account by the next one.") {
+			CHECK(root->gui_find_control(on_a) == node_a);
+			node_a->set_position(Point2i(200, 200));
+			CHECK_FALSE(root->gui_find_control(on_a));
+			CHECK(root->gui_find_control(Point2i(205, 205)) == node_a);
+			node_a->set_size(Point2i(100, 100));
+			CHECK(root->gui_find_control(Point2i(290, 290)) == node_a);
+
+			node_a->set_position(Point2i(10, 10));
+			CHECK(root->gui_find_control(on_b) == node_b);
+			root->move_child(node_a, -1);
+			CHECK(root->gui_find_control(on_b) == node_a);
+			node_a->set_mouse_filter(Control::MOUSE_FILTER_IGNORE);
+			CHECK(root->gui_find_control(on_b) == node_b);
+			node_a->set_mouse_filter(Control::MOUSE_FILTER_STOP);
+			node_a->set_rotation(Math_PI);
+			CHECK(root->gui_find_control(on_b) == node_b);
+			CHECK(root->gui_find_control(Point2i(5, 5)) == node_a);
+
+			root->set_canvas_transform(Transform2D(0, Vector2(300, 0)));
+			CHECK_FALSE(root->gui_find_control(on_g));
+			CHECK(root->gui_find_control(on_g + Point2i(300, 0)) == node_g);
+			root->set_canvas_transform(Transform2D());
+			CHECK(root->gui_find_control(on_g) == node_g);
+		}
+
+		SUBCASE("[VIEWPORT][GuiFindControl] Only transforms of Controls and of canvas items between them update the index.") {
+			Node2D *unrelated = memnew(Node2D);
+			root->add_child(unrelated);
+			Node2D *unrelated_child = memnew(Node2D);
+			node_b->add_child(unrelated_child);
+
+			CHECK(root->gui_find_control(on_d) == node_d);
+			unrelated->set_position(Point2(50, 50));
+			unrelated_child->set_position(Point2(50, 50));
+			CHECK_FALSE(TestViewportAccessor::is_gui_pick_index_dirty(root));
+
+			node_c->set_position(Point2(100, 0));
+			CHECK(TestViewportAccessor::is_gui_pick_index_dirty(root));
+			CHECK(root->gui_find_control(on_d) == node_b);
+			CHECK(root->gui_find_control(on_d + Point2i(100, 0)) == node_d);
+
+			// Collapsed canvas items keep their Controls out of the index until they can be picked again.
+			node_c->set_scale(Vector2());
+			CHECK_FALSE(root->gui_find_control(on_d + Point2i(100, 0)));
+			node_c->set_scale(Vector2(1, 1));
+			CHECK(root->gui_find_control(on_d + Point2i(100, 0)) == node_d);
+
+			node_c->set_position(Point2());
+			memdelete(unrelated_child);
+			memdelete(unrelated);
+		}
+
+		SUBCASE("[VIEWPORT][GuiFindControl] Controls of hidden CanvasLayers can't be found.") {
+			CanvasLayer *layer = memnew(CanvasLayer);
+			root->add_child(layer);
+			Control *hud = memnew(Control);
+			hud->set_position(Point2i(1000, 1000));
+			hud->set_size(Point2i(10, 10));
+			layer->add_child(hud);
+
+			CHECK(root->gui_find_control(Point2i(1005, 1005)) == hud);
+			layer->hide();
+			CHECK_FALSE(root->gui_find_control(Point2i(1005, 1005)));
+			layer->show();
+			CHECK(root->gui_find_control(Point2i(1005, 1005)) == hud);
+
+			memdelete(layer);
+		}
+
+		SUBCASE("[VIEWPORT][GuiFindControl] Finding Controls among many siblings.") {
+			Control *container = memnew(Control);
+			container->set_position(Point2i(1000, 1000));
+			root->add_child(container);
+
+			LocalVector<Control *> cells;
+			for (int i = 0; i < 1024; i++) {
+				Control *cell = memnew(Control);
+				cell->set_position(Point2i((i % 32) * 10, (i / 32) * 10));
+				cell->set_size(Point2i(10, 10));
+				container->add_child(cell);
+				cells.push_back(cell);
+			}
+			// Overlaps the first cells, and is tested before them as it comes later in the tree.
+			Control *overlay = memnew(Control);
+			overlay->set_size(Point2i(15, 15));
+			container->add_child(overlay);
+
+			CHECK(root->gui_find_control(Point2i(1005, 1005)) == overlay);
+			CHECK(root->gui_find_control(Point2i(1017, 1005)) == cells[1]);
+			CHECK(root->gui_find_control(Point2i(1005, 1017)) == cells[32]);
+			CHECK(root->gui_find_control(Point2i(1315, 1315)) == cells[1023]);
+			CHECK(root->gui_find_control(Point2i(1155, 1245)) == cells[24 * 32 + 15]);
+			CHECK_FALSE(root->gui_find_control(Point2i(1325, 1005)));
+
+			cells[1023]->hide();
+			CHECK_FALSE(root->gui_find_control(Point2i(1315, 1315)));
+			container->set_clip_contents(true);
+			container->set_size(Point2i(160, 160));
+			CHECK(root->gui_find_control(Point2i(1155, 1155)) == cells[15 * 32 + 15]);
+			CHECK_FALSE(root->gui_find_control(Point2i(1165, 1155)));
+
+			memdelete(container);
+		}
 	}
 
 	SUBCASE("[Viewport][GuiInputEvent] nullptr as argument doesn't lead to a crash.") {
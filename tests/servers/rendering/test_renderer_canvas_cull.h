@@ -0,0 +1,154 @@
+/**************************************************************************/
+/*  test_renderer_canvas_cull.h                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_RENDERER_CANVAS_CULL_H
+#define TEST_RENDERER_CANVAS_CULL_H
+
+#include "core/math/random_number_generator.h"
+#include "servers/rendering/renderer_canvas_cull.h"
+#include "servers/rendering/rendering_server_globals.h"
+
+#include "tests/test_macros.h"
+
+class TestRendererCanvasCullAccessor {
+public:
+	static void set_thread_cull_threshold(uint32_t p_threshold) {
+		RSG::canvas->thread_cull_threshold = p_threshold;
+	}
+
+	static uint32_t get_thread_cull_threshold() {
+		return RSG::canvas->thread_cull_threshold;
+	}
+
+	// Culls the tree under the item, and returns the items of every z index in draw order.
+	static LocalVector<LocalVector<RendererCanvasRender::Item *>> cull(RID p_item) {
+		const int z_range = RendererCanvasCull::z_range;
+		LocalVector<RendererCanvasRender::Item *> z_list;
+		LocalVector<RendererCanvasRender::Item *> z_last_list;
+		z_list.resize(z_range);
+		z_last_list.resize(z_range);
+		for (int i = 0; i < z_range; i++) {
+			z_list[i] = nullptr;
+			z_last_list[i] = nullptr;
+		}
+
+		RendererCanvasCull::Item *item = RSG::canvas->canvas_item_owner.get_or_null(p_item);
+		RSG::canvas->_cull_canvas_item(item, Transform2D(), Rect2(-10000, -10000, 20000, 20000), Color(1, 1, 1, 1), 0, z_list.ptr(), z_last_list.ptr(), nullptr, nullptr, true, 0xFFFFFFFF);
+
+		LocalVector<LocalVector<RendererCanvasRender::Item *>> result;
+		result.resize(z_range);
+		for (int i = 0; i < z_range; i++) {
+			for (RendererCanvasRender::Item *E = z_list[i]; E; E = E->next) {
+				result[i].push_back(E);
+			}
+		}
+		return result;
+	}
+};
+
+namespace TestRendererCanvasCull {
+
+TEST_CASE("[SceneTree][RendererCanvasCull] Threaded culling matches serial culling") {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	LocalVector<RID> items;
+
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(1234);
+
+	RID root = rs->canvas_item_create();
+	items.push_back(root);
+	rs->canvas_item_add_rect(root, Rect2(0, 0, 10, 10), Color(1, 1, 1));
+
+	for (int i = 0; i < 600; i++) {
+		RID child = rs->canvas_item_create();
+		items.push_back(child);
+		rs->canvas_item_set_parent(child, root);
+		rs->canvas_item_add_rect(child, Rect2(rng->randf_range(-500, 500), rng->randf_range(-500, 500), 10, 10), Color(1, 1, 1));
+		rs->canvas_item_set_z_index(child, rng->randi_range(-3, 3));
+		rs->canvas_item_set_z_as_relative_to_parent(child, i % 5 != 0);
+		rs->canvas_item_set_draw_behind_parent(child, i % 11 == 0);
+
+		if (i % 50 == 0) {
+			// A Y-sorted subtree, which is large enough to be split across threads on its own.
+			rs->canvas_item_set_sort_children_by_y(child, true);
+			for (int j = 0; j < 300; j++) {
+				RID grandchild = rs->canvas_item_create();
+				items.push_back(grandchild);
+				rs->canvas_item_set_parent(grandchild, child);
+				rs->canvas_item_set_transform(grandchild, Transform2D(0, Vector2(rng->randf_range(-500, 500), rng->randf_range(-500, 500))));
+				rs->canvas_item_add_rect(grandchild, Rect2(0, 0, 5, 5), Color(1, 1, 1));
+				rs->canvas_item_set_z_index(grandchild, rng->randi_range(-2, 2));
+			}
+		}
+	}
+
+	const uint32_t threshold = TestRendererCanvasCullAccessor::get_thread_cull_threshold();
+
+	TestRendererCanvasCullAccessor::set_thread_cull_threshold(UINT32_MAX);
+	LocalVector<LocalVector<RendererCanvasRender::Item *>> serial = TestRendererCanvasCullAccessor::cull(root);
+
+	TestRendererCanvasCullAccessor::set_thread_cull_threshold(2);
+	LocalVector<LocalVector<RendererCanvasRender::Item *>> threaded = TestRendererCanvasCullAccessor::cull(root);
+	// Run twice, as the per-thread lists are reused.
+	LocalVector<LocalVector<RendererCanvasRender::Item *>> threaded_again = TestRendererCanvasCullAccessor::cull(root);
+
+	// Enough children to cull on threads, but too few drawn behind the root to do the same for them.
+	TestRendererCanvasCullAccessor::set_thread_cull_threshold(100);
+	LocalVector<LocalVector<RendererCanvasRender::Item *>> threaded_front = TestRendererCanvasCullAccessor::cull(root);
+
+	TestRendererCanvasCullAccessor::set_thread_cull_threshold(threshold);
+
+	uint32_t item_count = 0;
+	bool matches = true;
+	for (uint32_t i = 0; i < serial.size(); i++) {
+		item_count += serial[i].size();
+		if (serial[i].size() != threaded[i].size() || serial[i].size() != threaded_again[i].size() || serial[i].size() != threaded_front[i].size()) {
+			matches = false;
+			continue;
+		}
+		for (uint32_t j = 0; j < serial[i].size(); j++) {
+			if (serial[i][j] != threaded[i][j] || serial[i][j] != threaded_again[i][j] || serial[i][j] != threaded_front[i][j]) {
+				matches = false;
+			}
+		}
+	}
+
+	CHECK(item_count == items.size());
+	CHECK_MESSAGE(matches, "Every z index should list the same items in the same order.");
+
+	for (int i = items.size() - 1; i >= 0; i--) {
+		rs->free(items[i]);
+	}
+}
+
+} // namespace TestRendererCanvasCull
+
+#endif // TEST_RENDERER_CANVAS_CULL_H
@@ -0,0 +1,291 @@
+/**************************************************************************/
+/*  test_renderer_scene_cull.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_RENDERER_SCENE_CULL_H
+#define TEST_RENDERER_SCENE_CULL_H
+
+#include "core/math/projection.h"
+#include "core/math/random_number_generator.h"
+#include "core/os/os.h"
+#include "servers/rendering/renderer_scene_cull.h"
+#include "servers/rendering_server.h"
+
+#include "tests/test_macros.h"
+
+namespace TestRendererSceneCull {
+
+TEST_CASE("[RendererSceneCull] Block frustum test matches per-instance test") {
+	Projection projection;
+	projection.set_perspective(70, 16.0 / 9.0, 0.05, 100);
+	Transform3D camera_transform;
+	camera_transform.origin = Vector3(1, 2, 3);
+	camera_transform.basis = Basis::from_euler(Vector3(0.3, 0.7, 0));
+	RendererSceneCull::Frustum frustum(projection.get_projection_planes(camera_transform));
+
+	// Small pages, so blocks span page boundaries.
+	PagedArrayPool<RendererSceneCull::InstanceBounds> pool(16);
+	PagedArray<RendererSceneCull::InstanceBounds> instance_aabbs;
+	instance_aabbs.set_page_pool(&pool);
+
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(42);
+
+	const uint32_t instance_count = 1000;
+	for (uint32_t i = 0; i < instance_count; i++) {
+		AABB aabb(Vector3(rng->randf_range(-100, 100), rng->randf_range(-100, 100), rng->randf_range(-100, 100)), Vector3(rng->randf_range(0, 10), rng->randf_range(0, 10), rng->randf_range(0, 10)));
+		instance_aabbs.push_back(RendererSceneCull::InstanceBounds(aabb));
+	}
+
+	uint32_t visible_count = 0;
+	bool matches = true;
+	RendererSceneCull::InstanceBoundsBlock block;
+	for (uint32_t from = 0; from < instance_count; from += RendererSceneCull::InstanceBoundsBlock::SIZE) {
+		block.load(instance_aabbs, from, MIN(instance_count - from, RendererSceneCull::InstanceBoundsBlock::SIZE));
+		uint64_t mask = block.in_frustum_mask(frustum);
+		for (uint32_t i = 0; i < block.count; i++) {
+			bool visible = (mask >> i) & 1;
+			if (visible != instance_aabbs[from + i].in_frustum(frustum)) {
+				matches = false;
+			}
+			visible_count += visible;
+		}
+	}
+
+	CHECK_MESSAGE(matches, "Every instance should get the same result from the block test as from the per-instance test.");
+	CHECK_MESSAGE(visible_count > 0, "Some instances should be inside the frustum.");
+	CHECK_MESSAGE(visible_count < instance_count, "Some instances should be outside the frustum.");
+
+	instance_aabbs.reset();
+}
+
+static RendererSceneCull::Frustum make_test_frustum() {
+	Projection projection;
+	projection.set_perspective(70, 16.0 / 9.0, 0.05, 100);
+	Transform3D camera_transform;
+	camera_transform.origin = Vector3(1, 2, 3);
+	camera_transform.basis = Basis::from_euler(Vector3(0.3, 0.7, 0));
+	return RendererSceneCull::Frustum(projection.get_projection_planes(camera_transform));
+}
+
+static void add_random_instances(PagedArray<RendererSceneCull::InstanceBounds> &r_instance_aabbs, uint32_t p_count) {
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(42);
+	for (uint32_t i = 0; i < p_count; i++) {
+		AABB aabb(Vector3(rng->randf_range(-100, 100), rng->randf_range(-100, 100), rng->randf_range(-100, 100)), Vector3(rng->randf_range(0, 10), rng->randf_range(0, 10), rng->randf_range(0, 10)));
+		r_instance_aabbs.push_back(RendererSceneCull::InstanceBounds(aabb));
+	}
+}
+
+TEST_CASE("[RendererSceneCull] Block frustum test with a partial load mask") {
+	RendererSceneCull::Frustum frustum = make_test_frustum();
+	PagedArrayPool<RendererSceneCull::InstanceBounds> pool;
+	PagedArray<RendererSceneCull::InstanceBounds> instance_aabbs;
+	instance_aabbs.set_page_pool(&pool);
+
+	const uint32_t instance_count = RendererSceneCull::InstanceBoundsBlock::SIZE * 4;
+	add_random_instances(instance_aabbs, instance_count);
+
+	bool matches = true;
+	RendererSceneCull::InstanceBoundsBlock block;
+	// Every other instance, as if the rest failed the layer check.
+	const uint64_t load_mask = 0x5555555555555555ULL;
+	for (uint32_t from = 0; from < instance_count; from += RendererSceneCull::InstanceBoundsBlock::SIZE) {
+		block.load(instance_aabbs, from, RendererSceneCull::InstanceBoundsBlock::SIZE, load_mask);
+		uint64_t mask = block.in_frustum_mask(frustum) & load_mask;
+		for (uint32_t i = 0; i < block.count; i++) {
+			bool expected = ((load_mask >> i) & 1) && instance_aabbs[from + i].in_frustum(frustum);
+			if (bool((mask >> i) & 1) != expected) {
+				matches = false;
+			}
+		}
+	}
+
+	CHECK_MESSAGE(matches, "Loaded instances should get the same result as from the per-instance test.");
+
+	instance_aabbs.reset();
+}
+
+static PackedFloat32Array make_translation_buffer(const Vector<Vector3> &p_origins) {
+	// Same layout as multimesh_set_buffer(): a 3x4 row-major matrix per instance.
+	PackedFloat32Array buffer;
+	for (const Vector3 &origin : p_origins) {
+		const float data[12] = { 1, 0, 0, (float)origin.x, 0, 1, 0, (float)origin.y, 0, 0, 1, (float)origin.z };
+		for (float value : data) {
+			buffer.push_back(value);
+		}
+	}
+	return buffer;
+}
+
+static bool is_instance_at(RID p_scenario, ObjectID p_id, const Vector3 &p_position) {
+	Vector<ObjectID> found = RS::get_singleton()->instances_cull_aabb(AABB(p_position - Vector3(0.1, 0.1, 0.1), Vector3(0.2, 0.2, 0.2)), p_scenario);
+	return found.has(p_id);
+}
+
+TEST_CASE("[SceneTree][RenderingServer] Setting instance transforms in a batch") {
+	RenderingServer *rs = RS::get_singleton();
+	RID scenario = rs->scenario_create();
+	RID mesh = rs->mesh_create();
+
+	const int instance_count = 3;
+	Vector<RID> instances;
+	PackedInt64Array instance_ids;
+	for (int i = 0; i < instance_count; i++) {
+		RID instance = rs->instance_create2(mesh, scenario);
+		rs->instance_set_custom_aabb(instance, AABB(Vector3(-0.5, -0.5, -0.5), Vector3(1, 1, 1)));
+		rs->instance_attach_object_instance_id(instance, ObjectID(uint64_t(i + 1)));
+		instances.push_back(instance);
+		instance_ids.push_back(instance.get_id());
+	}
+
+	Vector<Vector3> origins;
+	origins.push_back(Vector3(10, 0, 0));
+	origins.push_back(Vector3(0, 10, 0));
+	origins.push_back(Vector3(0, 0, 10));
+
+	SUBCASE("PackedFloat32Array buffer") {
+		rs->call("instance_set_transforms", instance_ids, make_translation_buffer(origins));
+		for (int i = 0; i < instance_count; i++) {
+			CHECK(is_instance_at(scenario, ObjectID(uint64_t(i + 1)), origins[i]));
+			CHECK_FALSE(is_instance_at(scenario, ObjectID(uint64_t(i + 1)), Vector3()));
+		}
+	}
+
+	SUBCASE("Transform3D vector") {
+		Vector<Transform3D> transforms;
+		for (const Vector3 &origin : origins) {
+			transforms.push_back(Transform3D(Basis(), origin));
+		}
+		rs->instance_set_transforms(instances, transforms);
+		for (int i = 0; i < instance_count; i++) {
+			CHECK(is_instance_at(scenario, ObjectID(uint64_t(i + 1)), origins[i]));
+		}
+	}
+
+	SUBCASE("Buffer length must match the instance count") {
+		PackedFloat32Array buffer = make_translation_buffer(origins);
+		buffer.resize(buffer.size() - 12);
+		ERR_PRINT_OFF;
+		rs->call("instance_set_transforms", instance_ids, buffer);
+		ERR_PRINT_ON;
+		for (int i = 0; i < instance_count; i++) {
+			CHECK_MESSAGE(is_instance_at(scenario, ObjectID(uint64_t(i + 1)), Vector3()), "A short buffer should be rejected as a whole.");
+		}
+	}
+
+	SUBCASE("Buffer stride must be 12 floats per instance") {
+		// 16 floats per instance, as if full 4x4 matrices were passed.
+		PackedFloat32Array buffer;
+		for (int i = 0; i < instance_count; i++) {
+			Projection matrix = Projection(Transform3D(Basis(), origins[i]));
+			for (int j = 0; j < 16; j++) {
+				buffer.push_back(matrix.columns[j / 4][j % 4]);
+			}
+		}
+		ERR_PRINT_OFF;
+		rs->call("instance_set_transforms", instance_ids, buffer);
+		ERR_PRINT_ON;
+		for (int i = 0; i < instance_count; i++) {
+			CHECK_MESSAGE(is_instance_at(scenario, ObjectID(uint64_t(i + 1)), Vector3()), "A buffer with the wrong stride should be rejected as a whole.");
+		}
+	}
+
+	SUBCASE("Transform count must match the instance count") {
+		Vector<Transform3D> transforms;
+		transforms.push_back(Transform3D(Basis(), origins[0]));
+		ERR_PRINT_OFF;
+		rs->instance_set_transforms(instances, transforms);
+		ERR_PRINT_ON;
+		CHECK(is_instance_at(scenario, ObjectID(uint64_t(1)), Vector3()));
+	}
+
+	SUBCASE("Invalid instances are skipped") {
+		PackedInt64Array ids = instance_ids;
+		ids.set(1, 0);
+		ERR_PRINT_OFF;
+		rs->call("instance_set_transforms", ids, make_translation_buffer(origins));
+		ERR_PRINT_ON;
+		CHECK(is_instance_at(scenario, ObjectID(uint64_t(1)), origins[0]));
+		CHECK(is_instance_at(scenario, ObjectID(uint64_t(2)), Vector3()));
+		CHECK(is_instance_at(scenario, ObjectID(uint64_t(3)), origins[2]));
+	}
+
+	for (const RID &instance : instances) {
+		rs->free(instance);
+	}
+	rs->free(mesh);
+	rs->free(scenario);
+}
+
+TEST_CASE("[RendererSceneCull][Benchmark] Block and per-instance frustum tests" * doctest::skip()) {
+	RendererSceneCull::Frustum frustum = make_test_frustum();
+	PagedArrayPool<RendererSceneCull::InstanceBounds> pool;
+	PagedArray<RendererSceneCull::InstanceBounds> instance_aabbs;
+	instance_aabbs.set_page_pool(&pool);
+
+	const uint32_t instance_count = 1 << 20;
+	const int rounds = 20;
+	add_random_instances(instance_aabbs, instance_count);
+
+	uint64_t visible_per_instance = 0;
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int round = 0; round < rounds; round++) {
+		for (uint32_t i = 0; i < instance_count; i++) {
+			visible_per_instance += instance_aabbs[i].in_frustum(frustum);
+		}
+	}
+	const uint64_t per_instance_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	uint64_t visible_block = 0;
+	RendererSceneCull::InstanceBoundsBlock block;
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int round = 0; round < rounds; round++) {
+		for (uint32_t from = 0; from < instance_count; from += RendererSceneCull::InstanceBoundsBlock::SIZE) {
+			block.load(instance_aabbs, from, RendererSceneCull::InstanceBoundsBlock::SIZE);
+			for (uint64_t mask = block.in_frustum_mask(frustum); mask; mask &= mask - 1) {
+				visible_block++;
+			}
+		}
+	}
+	const uint64_t block_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	const double tests = double(instance_count) * rounds;
+	MESSAGE("Per-instance frustum test: ", per_instance_usec * 1000.0 / tests, " ns per instance.");
+	MESSAGE("Block frustum test (including loading): ", block_usec * 1000.0 / tests, " ns per instance.");
+	CHECK(visible_per_instance == visible_block);
+
+	instance_aabbs.reset();
+}
+
+} // namespace TestRendererSceneCull
+
+#endif // TEST_RENDERER_SCENE_CULL_H
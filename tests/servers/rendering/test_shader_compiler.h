@@ -0,0 +1,133 @@
+/**************************************************************************/
+/*  test_shader_compiler.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SHADER_COMPILER_H
+#define TEST_SHADER_COMPILER_H
+
+#include "servers/rendering/shader_compiler.h"
+
+#include "tests/test_macros.h"
+
+class TestShaderCompilerAccessor {
+public:
+	static bool is_cached(ShaderCompiler &p_compiler, const String &p_code) {
+		return p_compiler.compile_cache.has(p_code);
+	}
+
+	static size_t get_cache_size(ShaderCompiler &p_compiler) {
+		return p_compiler.compile_cache.get_size();
+	}
+
+	static uint32_t get_cache_capacity() {
+		return ShaderCompiler::COMPILE_CACHE_MAX_ENTRIES;
+	}
+};
+
+namespace TestShaderCompiler {
+
+static String make_spatial_code(int p_value) {
+	return vformat("shader_type spatial;\n\nvoid fragment() {\n\tALBEDO = vec3(%d.0);\n}\n", p_value);
+}
+
+static void initialize_compiler(ShaderCompiler &p_compiler) {
+	ShaderCompiler::DefaultIdentifierActions actions;
+	actions.default_filter = ShaderLanguage::FILTER_LINEAR_MIPMAP;
+	actions.default_repeat = ShaderLanguage::REPEAT_ENABLE;
+	p_compiler.initialize(actions);
+}
+
+static Error compile_spatial(ShaderCompiler &p_compiler, const String &p_code, bool &r_albedo_written, ShaderCompiler::GeneratedCode &r_gen_code) {
+	HashMap<StringName, ShaderLanguage::ShaderNode::Uniform> uniforms;
+	ShaderCompiler::IdentifierActions actions;
+	actions.entry_point_stages["fragment"] = ShaderCompiler::STAGE_FRAGMENT;
+	actions.write_flag_pointers["ALBEDO"] = &r_albedo_written;
+	actions.uniforms = &uniforms;
+	return p_compiler.compile(RS::SHADER_SPATIAL, p_code, &actions, "", r_gen_code);
+}
+
+TEST_CASE("[ShaderCompiler] Compile cache") {
+	ShaderCompiler compiler;
+	initialize_compiler(compiler);
+	const String code = make_spatial_code(1);
+
+	bool albedo_written = false;
+	ShaderCompiler::GeneratedCode gen_code;
+	REQUIRE(compile_spatial(compiler, code, albedo_written, gen_code) == OK);
+	CHECK(albedo_written);
+	CHECK(TestShaderCompilerAccessor::is_cached(compiler, code));
+
+	SUBCASE("Compiling the same code again reuses the result and its side effects") {
+		bool cached_albedo_written = false;
+		ShaderCompiler::GeneratedCode cached_gen_code;
+		REQUIRE(compile_spatial(compiler, code, cached_albedo_written, cached_gen_code) == OK);
+		CHECK_MESSAGE(cached_albedo_written, "Write flags should be set again on a cache hit.");
+		CHECK(cached_gen_code.code["fragment"] == gen_code.code["fragment"]);
+		CHECK(TestShaderCompilerAccessor::get_cache_size(compiler) == 1);
+	}
+
+	SUBCASE("Different code is compiled and cached separately") {
+		const String other_code = make_spatial_code(2);
+		CHECK_FALSE(TestShaderCompilerAccessor::is_cached(compiler, other_code));
+
+		bool other_albedo_written = false;
+		ShaderCompiler::GeneratedCode other_gen_code;
+		REQUIRE(compile_spatial(compiler, other_code, other_albedo_written, other_gen_code) == OK);
+		CHECK(other_gen_code.code["fragment"] != gen_code.code["fragment"]);
+		CHECK(TestShaderCompilerAccessor::is_cached(compiler, other_code));
+		CHECK(TestShaderCompilerAccessor::get_cache_size(compiler) == 2);
+	}
+
+	SUBCASE("Reinitializing the compiler invalidates the cache") {
+		initialize_compiler(compiler);
+		CHECK_FALSE(TestShaderCompilerAccessor::is_cached(compiler, code));
+		CHECK(TestShaderCompilerAccessor::get_cache_size(compiler) == 0);
+	}
+
+	SUBCASE("The least recently compiled code is evicted when the cache is full") {
+		const uint32_t capacity = TestShaderCompilerAccessor::get_cache_capacity();
+		for (uint32_t i = 2; i <= capacity; i++) {
+			REQUIRE(compile_spatial(compiler, make_spatial_code(i), albedo_written, gen_code) == OK);
+		}
+		CHECK(TestShaderCompilerAccessor::get_cache_size(compiler) == capacity);
+
+		// Using the first code again makes the second one the least recently used.
+		REQUIRE(compile_spatial(compiler, code, albedo_written, gen_code) == OK);
+		REQUIRE(compile_spatial(compiler, make_spatial_code(capacity + 1), albedo_written, gen_code) == OK);
+
+		CHECK(TestShaderCompilerAccessor::get_cache_size(compiler) == capacity);
+		CHECK(TestShaderCompilerAccessor::is_cached(compiler, code));
+		CHECK_FALSE(TestShaderCompilerAccessor::is_cached(compiler, make_spatial_code(2)));
+		CHECK(TestShaderCompilerAccessor::is_cached(compiler, make_spatial_code(capacity + 1)));
+	}
+}
+
+} // namespace TestShaderCompiler
+
+#endif // TEST_SHADER_COMPILER_H
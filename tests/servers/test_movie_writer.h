@@ -0,0 +1,172 @@
+/**************************************************************************/
+/*  test_movie_writer.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MOVIE_WRITER_H
+#define TEST_MOVIE_WRITER_H
+
+#include "core/config/project_settings.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "servers/movie_writer/movie_writer_mjpeg.h"
+#include "servers/movie_writer/movie_writer_pngwav.h"
+
+#include "tests/test_macros.h"
+
+class TestMovieWriterAccessor {
+public:
+	// Records the given frames without going through the viewport, the display server or the audio driver.
+	static void record(MovieWriter *p_writer, const String &p_base_path, uint32_t p_fps, const Vector<Ref<Image>> &p_frames, const Vector<Vector<int32_t>> &p_audio) {
+		p_writer->mix_rate = p_writer->get_audio_mix_rate();
+		p_writer->fps = p_fps;
+		p_writer->audio_channels = (p_writer->get_audio_speaker_mode() + 1) * 2;
+		p_writer->audio_mix_buffer.resize(p_writer->mix_rate * p_writer->audio_channels / p_fps);
+
+		p_writer->_begin_encoding();
+		p_writer->write_begin(p_frames[0]->get_size(), p_fps, p_base_path);
+		for (int i = 0; i < p_frames.size(); i++) {
+			REQUIRE(p_audio[i].size() == (int)p_writer->audio_mix_buffer.size());
+			p_writer->_submit_frame(p_frames[i], p_audio[i].ptr());
+		}
+		p_writer->_flush_encoded_frames(true);
+		p_writer->encode_ring.clear();
+		p_writer->write_end();
+	}
+
+	static uint32_t get_audio_block_size(MovieWriter *p_writer, uint32_t p_fps) {
+		return p_writer->get_audio_mix_rate() * (p_writer->get_audio_speaker_mode() + 1) * 2 / p_fps;
+	}
+};
+
+namespace TestMovieWriter {
+
+static const uint32_t TEST_FPS = 30;
+
+static void make_test_frames(int p_count, uint32_t p_audio_block_size, Vector<Ref<Image>> &r_frames, Vector<Vector<int32_t>> &r_audio) {
+	for (int i = 0; i < p_count; i++) {
+		Ref<Image> image = Image::create_empty(64, 48, false, Image::FORMAT_RGB8);
+		for (int y = 0; y < image->get_height(); y++) {
+			for (int x = 0; x < image->get_width(); x++) {
+				image->set_pixel(x, y, Color((x * 4 + i * 16) % 256 / 255.0, (y * 5) % 256 / 255.0, ((x ^ y) * 3 + i * 7) % 256 / 255.0));
+			}
+		}
+		r_frames.push_back(image);
+
+		Vector<int32_t> audio;
+		audio.resize(p_audio_block_size);
+		for (uint32_t j = 0; j < p_audio_block_size; j++) {
+			audio.write[j] = int32_t((i * 7919 + j * 104729) % 65536 - 32768) << 16;
+		}
+		r_audio.push_back(audio);
+	}
+}
+
+// Records the frames with the given number of frames in flight, and returns the contents of every file written.
+template <typename T>
+static Vector<Vector<uint8_t>> record_movie(const String &p_file, int p_max_frames_in_flight, const Vector<Ref<Image>> &p_frames, const Vector<Vector<int32_t>> &p_audio, const PackedStringArray &p_outputs) {
+	const String dir = OS::get_singleton()->get_cache_path().path_join(vformat("test_movie_writer_%d", p_max_frames_in_flight));
+	DirAccess::make_dir_recursive_absolute(dir);
+
+	const Variant previous_max_frames = ProjectSettings::get_singleton()->get_setting("editor/movie_writer/max_frames_in_flight");
+	ProjectSettings::get_singleton()->set_setting("editor/movie_writer/max_frames_in_flight", p_max_frames_in_flight);
+	T *writer = memnew(T);
+	TestMovieWriterAccessor::record(writer, dir.path_join(p_file), TEST_FPS, p_frames, p_audio);
+	memdelete(writer);
+	ProjectSettings::get_singleton()->set_setting("editor/movie_writer/max_frames_in_flight", previous_max_frames);
+
+	Vector<Vector<uint8_t>> contents;
+	for (const String &output : p_outputs) {
+		contents.push_back(FileAccess::get_file_as_bytes(dir.path_join(output)));
+	}
+
+	Ref<DirAccess> da = DirAccess::open(dir);
+	if (da.is_valid()) {
+		da->erase_contents_recursive();
+		da->remove(dir);
+	}
+	return contents;
+}
+
+TEST_CASE("[MovieWriter] PNG/WAV output doesn't depend on the number of frames in flight") {
+	const int frame_count = 12;
+	PackedStringArray outputs;
+	outputs.push_back("movie.wav");
+	for (int i = 0; i < frame_count; i++) {
+		outputs.push_back(vformat("movie%08d.png", i));
+	}
+
+	MovieWriterPNGWAV *probe = memnew(MovieWriterPNGWAV);
+	const uint32_t audio_block_size = TestMovieWriterAccessor::get_audio_block_size(probe, TEST_FPS);
+	memdelete(probe);
+
+	Vector<Ref<Image>> frames;
+	Vector<Vector<int32_t>> audio;
+	make_test_frames(frame_count, audio_block_size, frames, audio);
+
+	Vector<Vector<uint8_t>> serial = record_movie<MovieWriterPNGWAV>("movie.png", 1, frames, audio, outputs);
+	Vector<Vector<uint8_t>> threaded = record_movie<MovieWriterPNGWAV>("movie.png", 4, frames, audio, outputs);
+
+	REQUIRE(serial.size() == outputs.size());
+	REQUIRE(threaded.size() == outputs.size());
+	for (int i = 0; i < outputs.size(); i++) {
+		CHECK_MESSAGE(!serial[i].is_empty(), vformat("\"%s\" should have been written.", outputs[i]));
+		CHECK_MESSAGE(serial[i] == threaded[i], vformat("\"%s\" should be identical with and without threaded encoding.", outputs[i]));
+	}
+}
+
+TEST_CASE("[MovieWriter] MJPEG output doesn't depend on the number of frames in flight") {
+	if (!Image::save_jpg_func) {
+		MESSAGE("Skipping, JPEG encoding is not available in this build.");
+		return;
+	}
+
+	PackedStringArray outputs;
+	outputs.push_back("movie.avi");
+
+	MovieWriterMJPEG *probe = memnew(MovieWriterMJPEG);
+	const uint32_t audio_block_size = TestMovieWriterAccessor::get_audio_block_size(probe, TEST_FPS);
+	memdelete(probe);
+
+	Vector<Ref<Image>> frames;
+	Vector<Vector<int32_t>> audio;
+	make_test_frames(12, audio_block_size, frames, audio);
+
+	Vector<Vector<uint8_t>> serial = record_movie<MovieWriterMJPEG>("movie.avi", 1, frames, audio, outputs);
+	Vector<Vector<uint8_t>> threaded = record_movie<MovieWriterMJPEG>("movie.avi", 4, frames, audio, outputs);
+
+	REQUIRE(serial.size() == 1);
+	REQUIRE(threaded.size() == 1);
+	CHECK(!serial[0].is_empty());
+	CHECK_MESSAGE(serial[0] == threaded[0], "The movie should be identical with and without threaded encoding.");
+}
+
+} // namespace TestMovieWriter
+
+#endif // TEST_MOVIE_WRITER_H
@@ -33,12 +33,35 @@
 
 #ifdef TOOLS_ENABLED
 
+#include "core/os/thread.h"
+#include "core/templates/safe_refcount.h"
+#include "core/variant/typed_array.h"
 #include "editor/builtin_fonts.gen.h"
 #include "servers/text_server.h"
 #include "tests/test_macros.h"
 
 namespace TestTextServer {
 
+struct ShapeWhileBatchingData {
+	Ref<TextServer> ts;
+	Array fonts;
+	String text;
+	SafeFlag done;
+	int shaped = 0;
+};
+
+// Shapes buffers one by one through the locked path, while another thread shapes a batch with the same fonts.
+static void _shape_while_batching(void *p_userdata) {
+	ShapeWhileBatchingData *data = (ShapeWhileBatchingData *)p_userdata;
+	while (!data->done.is_set() || data->shaped < 4) {
+		RID ctx = data->ts->create_shaped_text();
+		data->ts->shaped_text_add_string(ctx, data->text, data->fonts, 14);
+		data->ts->shaped_text_shape(ctx);
+		data->ts->free_rid(ctx);
+		data->shaped++;
+	}
+}
+
 TEST_SUITE("[TextServer]") {
 	TEST_CASE("[TextServer] Init, font loading and shaping") {
 		SUBCASE("[TextServer] Loading fonts") {
@@ -112,6 +135,175 @@ TEST_SUITE("[TextServer]") {
 			}
 		}
 
+		SUBCASE("[TextServer] Text layout: Reshaping identical text and batch shaping") {
+			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+				CHECK_FALSE_MESSAGE(ts.is_null(), "Invalid TS interface.");
+
+				if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC) || !ts->has_feature(TextServer::FEATURE_SIMPLE_LAYOUT)) {
+					continue;
+				}
+
+				RID font1 = ts->create_font();
+				ts->font_set_data_ptr(font1, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+				ts->font_set_allow_system_fallback(font1, false);
+
+				Array font;
+				font.push_back(font1);
+
+				String test = U"Shaped text ראה text";
+
+				RID ctx1 = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx1, test, font, 16);
+				RID ctx2 = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx2, test, font, 16);
+
+				CHECK(ts->shaped_text_shape(ctx1));
+				CHECK(ts->shaped_text_shape(ctx2));
+				CHECK(ts->shaped_text_get_size(ctx1) == ts->shaped_text_get_size(ctx2));
+				CHECK(ts->shaped_text_get_ascent(ctx1) == ts->shaped_text_get_ascent(ctx2));
+
+				const Glyph *glyphs1 = ts->shaped_text_get_glyphs(ctx1);
+				const Glyph *glyphs2 = ts->shaped_text_get_glyphs(ctx2);
+				int gl_size = ts->shaped_text_get_glyph_count(ctx1);
+				CHECK_FALSE_MESSAGE(gl_size == 0, "Shaping failed");
+				CHECK(gl_size == ts->shaped_text_get_glyph_count(ctx2));
+				if (gl_size == ts->shaped_text_get_glyph_count(ctx2)) {
+					for (int j = 0; j < gl_size; j++) {
+						CHECK(glyphs1[j].start == glyphs2[j].start);
+						CHECK(glyphs1[j].index == glyphs2[j].index);
+						CHECK(glyphs1[j].font_rid == glyphs2[j].font_rid);
+						CHECK(glyphs1[j].advance == glyphs2[j].advance);
+						CHECK(glyphs1[j].flags == glyphs2[j].flags);
+					}
+				}
+
+				// Substrings (line breaks) of both buffers are reordered the same way.
+				RID line1 = ts->shaped_text_substr(ctx1, 7, 9);
+				RID line2 = ts->shaped_text_substr(ctx2, 7, 9);
+				CHECK(ts->shaped_text_get_glyph_count(line1) > 0);
+				CHECK(ts->shaped_text_get_glyph_count(line1) == ts->shaped_text_get_glyph_count(line2));
+				CHECK(ts->shaped_text_get_size(line1) == ts->shaped_text_get_size(line2));
+				ts->free_rid(line1);
+				ts->free_rid(line2);
+
+				// Font changes apply to text shaped afterwards.
+				double width = ts->shaped_text_get_size(ctx1).x;
+				ts->font_set_spacing(font1, TextServer::SPACING_GLYPH, 4);
+				RID ctx3 = ts->create_shaped_text();
+				ts->shaped_text_add_string(ctx3, test, font, 16);
+				CHECK(ts->shaped_text_get_size(ctx3).x > width);
+
+				ts->free_rid(ctx1);
+				ts->free_rid(ctx2);
+				ts->free_rid(ctx3);
+
+				// Batch shaping gives the same result as shaping each buffer.
+				TypedArray<RID> batch;
+				Vector<RID> single;
+				for (int j = 0; j < 16; j++) {
+					String text = vformat(U"Paragraph %d ראה", j);
+					RID ctx = ts->create_shaped_text();
+					ts->shaped_text_add_string(ctx, text, font, 12 + j);
+					batch.push_back(ctx);
+					ctx = ts->create_shaped_text();
+					ts->shaped_text_add_string(ctx, text, font, 12 + j);
+					single.push_back(ctx);
+				}
+				batch.push_back(batch[0]);
+
+				CHECK(ts->shaped_text_shape_batch(batch));
+				for (int j = 0; j < single.size(); j++) {
+					CHECK(ts->shaped_text_is_ready(batch[j]));
+					CHECK(ts->shaped_text_shape(single[j]));
+					CHECK(ts->shaped_text_get_size(batch[j]) == ts->shaped_text_get_size(single[j]));
+					CHECK(ts->shaped_text_get_glyph_count(batch[j]) == ts->shaped_text_get_glyph_count(single[j]));
+					ts->free_rid(batch[j]);
+					ts->free_rid(single[j]);
+				}
+
+				for (int j = 0; j < font.size(); j++) {
+					ts->free_rid(font[j]);
+				}
+				font.clear();
+			}
+		}
+
+		SUBCASE("[TextServer] Text layout: Batch shaping with fallback fonts") {
+			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
+				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);
+				CHECK_FALSE_MESSAGE(ts.is_null(), "Invalid TS interface.");
+
+				if (!ts->has_feature(TextServer::FEATURE_FONT_DYNAMIC) || !ts->has_feature(TextServer::FEATURE_SIMPLE_LAYOUT)) {
+					continue;
+				}
+
+				RID font1 = ts->create_font();
+				ts->font_set_data_ptr(font1, _font_NotoSans_Regular, _font_NotoSans_Regular_size);
+				RID font2 = ts->create_font();
+				ts->font_set_data_ptr(font2, _font_NotoSansThai_Regular, _font_NotoSansThai_Regular_size);
+				RID font3 = ts->create_font();
+				ts->font_set_data_ptr(font3, _font_NotoNaskhArabicUI_Regular, _font_NotoNaskhArabicUI_Regular_size);
+
+				// Paragraphs fall back through the same fonts in opposite orders, and the first font of each
+				// list allows the system fallback (the default).
+				Array fonts_forward;
+				fonts_forward.push_back(font1);
+				fonts_forward.push_back(font2);
+				fonts_forward.push_back(font3);
+				Array fonts_backward;
+				fonts_backward.push_back(font3);
+				fonts_backward.push_back(font2);
+				fonts_backward.push_back(font1);
+
+				ShapeWhileBatchingData data;
+				data.ts = ts;
+				data.fonts = fonts_forward;
+				data.text = U"Text ภาษาไทย النص ✓";
+				Thread thread;
+				thread.start(_shape_while_batching, &data);
+
+				TypedArray<RID> batch;
+				Vector<RID> single;
+				for (int j = 0; j < 32; j++) {
+					String text = vformat(U"Paragraph %d ภาษาไทย النص ✓", j);
+					const Array &fonts = (j % 2) ? fonts_backward : fonts_forward;
+					RID ctx = ts->create_shaped_text();
+					ts->shaped_text_add_string(ctx, text, fonts, 12 + j);
+					batch.push_back(ctx);
+					ctx = ts->create_shaped_text();
+					ts->shaped_text_add_string(ctx, text, fonts, 12 + j);
+					single.push_back(ctx);
+				}
+
+				CHECK(ts->shaped_text_shape_batch(batch));
+				data.done.set();
+				thread.wait_to_finish();
+
+				for (int j = 0; j < single.size(); j++) {
+					CHECK(ts->shaped_text_is_ready(batch[j]));
+					CHECK(ts->shaped_text_shape(single[j]));
+					CHECK(ts->shaped_text_get_size(batch[j]) == ts->shaped_text_get_size(single[j]));
+					const int gl_size = ts->shaped_text_get_glyph_count(batch[j]);
+					CHECK(gl_size == ts->shaped_text_get_glyph_count(single[j]));
+					if (gl_size == ts->shaped_text_get_glyph_count(single[j])) {
+						const Glyph *glyphs1 = ts->shaped_text_get_glyphs(batch[j]);
+						const Glyph *glyphs2 = ts->shaped_text_get_glyphs(single[j]);
+						for (int k = 0; k < gl_size; k++) {
+							CHECK(glyphs1[k].index == glyphs2[k].index);
+							CHECK(glyphs1[k].font_rid == glyphs2[k].font_rid);
+						}
+					}
+					ts->free_rid(batch[j]);
+					ts->free_rid(single[j]);
+				}
+
+				ts->free_rid(font1);
+				ts->free_rid(font2);
+				ts->free_rid(font3);
+			}
+		}
+
 		SUBCASE("[TextServer] Text layout: BiDi") {
 			for (int i = 0; i < TextServerManager::get_singleton()->get_interface_count(); i++) {
 				Ref<TextServer> ts = TextServerManager::get_singleton()->get_interface(i);